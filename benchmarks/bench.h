@@ -0,0 +1,63 @@
+#ifndef ENUM_STRINGS_BENCH_H
+#define ENUM_STRINGS_BENCH_H
+
+/**
+ * @file bench.h
+ * @brief Minimal timing helpers shared by the benchmarks.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+namespace bench
+{
+
+/**
+ * @brief Keep a value alive so the computation producing it is not optimized away.
+ *
+ * Safe to call from several threads at once: nothing is written to shared memory.
+ */
+template <typename T>
+inline void keep(T const & v)
+{
+  std::size_t const value = static_cast<std::size_t>(v);
+#if defined(__GNUC__)
+  // An empty asm statement the compiler must assume reads the value
+  asm volatile("" : : "g"(value));
+#else
+  static thread_local volatile std::size_t sink;
+  sink = value;
+#endif
+}
+
+/**
+ * @brief Run a function once and report its throughput.
+ * @param name label to print
+ * @param items number of items processed by @p f
+ * @param f the function to time
+ * @return elapsed time in seconds
+ */
+template <typename F>
+inline double run(char const * const name, std::size_t const items, F && f)
+{
+  auto const start = std::chrono::steady_clock::now();
+  f();
+  auto const stop = std::chrono::steady_clock::now();
+  double const sec = std::chrono::duration<double>(stop - start).count();
+  std::printf("%-40s %10.2f ms %10.2f M items/s\n", name, sec * 1e3, items / sec * 1e-6);
+  return sec;
+}
+
+/**
+ * @brief Read the problem size from the first command line argument.
+ */
+inline std::size_t size_arg(int const argc, char ** const argv, std::size_t const def)
+{
+  return argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : def;
+}
+
+} // namespace bench
+
+#endif //ENUM_STRINGS_BENCH_H
@@ -0,0 +1,90 @@
+// Memory and latency of a 50000-name enumeration registered with ENUM_STRINGS (plus the generated
+// perfect hash lookup) against the same names stored front-coded. Both headers are generated from
+// bench_compressed.csv at configure time; names share long prefixes like ERR_STORAGE_BACKEND_.
+//
+// Usage: bench_compressed [conversions]
+
+#include "bench_compressed_plain.h"
+#include "bench_compressed_front_coded.h"
+#include "bench.h"
+
+#include <cstring>
+#include <vector>
+
+int main(int argc, char ** argv)
+{
+  std::size_t const n = bench::size_arg(argc, argv, 10000000);
+  std::size_t const count = enum_strings::num_values<plain::Symbol>();
+
+  std::size_t plain_bytes = count * (sizeof(char const *) + sizeof(std::size_t));
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    plain_bytes += enum_strings::to_string_view(static_cast<plain::Symbol>(i)).size() + 1;
+  }
+  auto const & table = _get_front_coded_names(front_coded::Symbol{});
+  std::printf("%zu names: %zu bytes as ENUM_STRINGS literals and tables (without the hash lookup), "
+              "%zu bytes front-coded in blocks of %zu\n\n",
+              count, plain_bytes, table.memory_usage(), table.block_size);
+
+  std::vector<std::size_t> codes(n);
+  unsigned x = 1;
+  for (auto & c : codes)
+  {
+    x = x * 1103515245u + 12345u;
+    c = (x >> 8) % count;
+  }
+  std::vector<std::string> strings(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    strings[i] = enum_strings::to_string(static_cast<plain::Symbol>(i));
+  }
+
+  char buf[enum_strings::compressed::max_stored_length];
+
+  bench::run("to_string_view + copy (ENUM_STRINGS)", n, [&]
+  {
+    std::size_t total = 0;
+    for (std::size_t const c : codes)
+    {
+      enum_strings::name_view const v = enum_strings::to_string_view(static_cast<plain::Symbol>(c));
+      std::memcpy(buf, v.data(), v.size());
+      total += v.size() + static_cast<unsigned char>(buf[v.size() - 1]);
+    }
+    bench::keep(total);
+  });
+
+  bench::run("compressed::to_string into buffer", n, [&]
+  {
+    std::size_t total = 0;
+    for (std::size_t const c : codes)
+    {
+      std::size_t const length = enum_strings::compressed::to_string(static_cast<front_coded::Symbol>(c), buf);
+      total += length + static_cast<unsigned char>(buf[length - 1]);
+    }
+    bench::keep(total);
+  });
+
+  bench::run("try_from_string (perfect hash)", n, [&]
+  {
+    std::size_t total = 0;
+    plain::Symbol e{};
+    for (std::size_t const c : codes)
+    {
+      total += enum_strings::try_from_string(strings[c].data(), strings[c].size(), e) ? static_cast<std::size_t>(e) : 0;
+    }
+    bench::keep(total);
+  });
+
+  bench::run("compressed::try_from_string", n, [&]
+  {
+    std::size_t total = 0;
+    front_coded::Symbol e{};
+    for (std::size_t const c : codes)
+    {
+      total += enum_strings::compressed::try_from_string(strings[c].data(), strings[c].size(), e) ? static_cast<std::size_t>(e) : 0;
+    }
+    bench::keep(total);
+  });
+
+  return 0;
+}
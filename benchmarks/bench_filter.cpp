@@ -0,0 +1,71 @@
+#include "enum_strings_filter.h"
+#include "bench.h"
+
+#include <vector>
+
+namespace
+{
+  enum class Status : std::uint8_t { ok, failed, timeout, retry, cancelled, pending, END };
+  ENUM_STRINGS(Status, "ok", "failed", "timeout", "retry", "cancelled", "pending");
+}
+
+int main(int argc, char ** argv)
+{
+  std::size_t const n = bench::size_arg(argc, argv, 100000000);
+  unsigned const bits = 3;
+#if defined(__AVX2__)
+  std::printf("Filters vectorized with AVX2\n");
+#else
+  std::printf("Filters not vectorized (build bench_filter_avx2 for AVX2)\n");
+#endif
+
+  std::vector<Status> codes(n);
+  unsigned x = 1;
+  for (auto & c : codes)
+  {
+    x = x * 1103515245u + 12345u;
+    c = static_cast<Status>((x >> 16) % enum_strings::num_values<Status>());
+  }
+  std::vector<std::uint64_t> packed(enum_strings::packed_words(n, bits));
+  enum_strings::pack_codes(codes.data(), n, bits, packed.data());
+
+  std::vector<std::uint64_t> bitmap(enum_strings::bitmap_words(n));
+  std::vector<std::uint32_t> indices(n);
+
+  bench::run("to_string + compare", n, [&]
+  {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      std::string const s = enum_strings::to_string(codes[i]);
+      count += (s == "failed" || s == "timeout");
+    }
+    bench::keep(count);
+  });
+
+  enum_strings::enum_filter<Status> const filter{ "failed", "timeout" };
+
+  bench::run("enum_filter::select", n, [&]
+  {
+    filter.select(codes.data(), n, bitmap.data());
+    bench::keep(bitmap.back());
+  });
+
+  bench::run("enum_filter::select_indices", n, [&]
+  {
+    bench::keep(filter.select_indices(codes.data(), n, indices.data()));
+  });
+
+  bench::run("enum_filter::select_packed (3 bits)", n, [&]
+  {
+    filter.select_packed(packed.data(), n, bits, bitmap.data());
+    bench::keep(bitmap.back());
+  });
+
+  bench::run("enum_filter::select_packed_indices", n, [&]
+  {
+    bench::keep(filter.select_packed_indices(packed.data(), n, bits, indices.data()));
+  });
+
+  return 0;
+}
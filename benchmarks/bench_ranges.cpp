@@ -0,0 +1,53 @@
+#include "enum_strings_ranges.h"
+#include "bench.h"
+
+#include <algorithm>
+
+namespace
+{
+  enum class Status { ok, failed, timeout, retry, cancelled, pending, END };
+  ENUM_STRINGS(Status, "ok", "failed", "timeout", "retry", "cancelled", "pending");
+}
+
+int main(int argc, char ** argv)
+{
+  std::size_t const n = bench::size_arg(argc, argv, 10000000);
+
+  std::string line;
+  unsigned x = 1;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    x = x * 1103515245u + 12345u;
+    if (i > 0) line += ',';
+    line += enum_strings::to_string(static_cast<Status>((x >> 16) % enum_strings::num_values<Status>()));
+  }
+
+  bench::run("materializing split/parse/filter/count", n, [&]
+  {
+    std::vector<std::string> fields;
+    for (std::size_t pos = 0, next; pos <= line.size(); pos = next + 1)
+    {
+      next = std::min(line.find(',', pos), line.size());
+      fields.emplace_back(line, pos, next - pos);
+    }
+    std::vector<Status> parsed;
+    for (auto const & f : fields)
+    {
+      parsed.push_back(enum_strings::from_string<Status>(f));
+    }
+    std::vector<Status> filtered;
+    std::copy_if(parsed.begin(), parsed.end(), std::back_inserter(filtered), [](Status const s) { return s != Status::ok; });
+    bench::keep(std::count(filtered.begin(), filtered.end(), Status::failed));
+  });
+
+  bench::run("lazy views split/parse/filter/count", n, [&]
+  {
+    auto statuses = std::string_view(line)
+                  | std::views::split(',')
+                  | enum_strings::views::parse_enum<Status>
+                  | std::views::filter([](Status const s) { return s != Status::ok; });
+    bench::keep(std::ranges::count(statuses, Status::failed));
+  });
+
+  return 0;
+}
@@ -0,0 +1,66 @@
+// Stream output and input of enums by name and, with the enum_strings::numeric manipulator, by numerical code.
+//
+// Usage: bench_stream [values]
+
+#include "enum_strings.h"
+#include "bench.h"
+
+#include <sstream>
+#include <vector>
+
+namespace
+{
+  enum class Status : std::uint8_t { ok, failed, timeout, retry, cancelled, pending, END };
+  ENUM_STRINGS(Status, "ok", "failed", "timeout", "retry", "cancelled", "pending");
+
+  template <typename F>
+  void round_trip(char const * const write_name, char const * const read_name,
+                  std::vector<Status> const & values, F const & format)
+  {
+    std::size_t const n = values.size();
+    std::ostringstream os;
+    format(os);
+    bench::run(write_name, n, [&]
+    {
+      for (Status const v : values)
+      {
+        os << v << '\n';
+      }
+      bench::keep(os.tellp());
+    });
+
+    std::istringstream is(os.str());
+    format(is);
+    std::vector<Status> back(n);
+    bench::run(read_name, n, [&]
+    {
+      for (Status & v : back)
+      {
+        is >> v;
+      }
+      bench::keep(static_cast<std::size_t>(back.back()));
+    });
+    if (back != values)
+    {
+      std::printf("round trip mismatch\n");
+    }
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  std::size_t const n = bench::size_arg(argc, argv, 10000000);
+
+  std::vector<Status> values(n);
+  unsigned x = 1;
+  for (auto & v : values)
+  {
+    x = x * 1103515245u + 12345u;
+    v = static_cast<Status>((x >> 16) % enum_strings::num_values<Status>());
+  }
+
+  round_trip("operator<< (names)", "operator>> (names)", values, [](std::ios_base & s) { enum_strings::names(s); });
+  round_trip("operator<< (numeric)", "operator>> (numeric)", values, [](std::ios_base & s) { enum_strings::numeric(s); });
+
+  return 0;
+}
@@ -0,0 +1,189 @@
+// Throughput of the conversions run concurrently on 1..N threads, to reveal shared state
+// that limits scaling (allocator contention, locale access in the stream operators, ...).
+//
+// Usage: bench_threads [items per thread] [max threads]
+//
+// Each API is run on 1, 2, 4, ... max threads (pinned to separate CPUs on Linux),
+// once with all threads reading the same input arrays and once with private copies
+// made by each thread. Ideal scaling keeps the per-thread rate constant.
+
+#include "enum_strings.h"
+#include "bench.h"
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace
+{
+  enum class Status : std::uint8_t { ok, failed, timeout, retry, cancelled, pending, a_status_name_outside_of_sso, END };
+  ENUM_STRINGS(Status, "ok", "failed", "timeout", "retry", "cancelled", "pending", "a_status_name_outside_of_sso");
+
+  void pin_to_cpu(unsigned const cpu)
+  {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % CPU_SETSIZE, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    static_cast<void>(cpu);
+#endif
+  }
+
+  struct inputs
+  {
+    std::vector<Status> codes;
+    std::vector<std::string> strings;
+    std::string text;
+  };
+
+  inputs make_inputs(std::size_t const n)
+  {
+    inputs in;
+    in.codes.resize(n);
+    in.strings.resize(n);
+    unsigned x = 1;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      x = x * 1103515245u + 12345u;
+      in.codes[i] = static_cast<Status>((x >> 16) % enum_strings::num_values<Status>());
+      in.strings[i] = enum_strings::to_string(in.codes[i]);
+      in.text += in.strings[i];
+      in.text += ' ';
+    }
+    return in;
+  }
+
+  /**
+   * @brief Run @p f(inputs) on @p threads pinned threads released together and report the total throughput.
+   * @return items per second over all threads
+   */
+  template <typename F>
+  double run_threads(unsigned const threads, bool const shared, inputs const & common, std::size_t const n, F const & f)
+  {
+    std::atomic<unsigned> ready{ 0 };
+    std::atomic<bool> go{ false };
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t)
+    {
+      pool.emplace_back([&, t]
+      {
+        pin_to_cpu(t);
+        inputs const own = shared ? inputs{} : make_inputs(n);
+        inputs const & in = shared ? common : own;
+        ready.fetch_add(1);
+        while (!go.load(std::memory_order_acquire)) {}
+        f(in);
+      });
+    }
+    while (ready.load() != threads) {}
+    auto const start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto & thread : pool)
+    {
+      thread.join();
+    }
+    double const sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(n) * threads / sec;
+  }
+
+  template <typename F>
+  void scaling(char const * const name, unsigned const max_threads, inputs const & common, std::size_t const n, F const & f)
+  {
+    for (bool const shared : { true, false })
+    {
+      std::printf("%s (%s inputs)\n", name, shared ? "shared" : "per-thread");
+      double base = 0.0;
+      for (unsigned threads = 1; threads <= max_threads; threads = threads < max_threads ? std::min(threads * 2, max_threads) : threads + 1)
+      {
+        double const rate = run_threads(threads, shared, common, n, f);
+        base = threads == 1 ? rate : base;
+        std::printf("  %4u threads %10.2f M items/s %8.2f M items/s/thread %6.2fx speedup\n",
+                    threads, rate * 1e-6, rate / threads * 1e-6, rate / base);
+      }
+    }
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  std::size_t const n = bench::size_arg(argc, argv, 1000000);
+  unsigned const hardware = std::max(std::thread::hardware_concurrency(), 1u);
+  unsigned const max_threads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : hardware;
+
+  inputs const common = make_inputs(n);
+
+  scaling("to_string_view", max_threads, common, n, [n](inputs const & in)
+  {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      count += enum_strings::to_string_view(in.codes[i]).size();
+    }
+    bench::keep(count);
+  });
+
+  scaling("to_string", max_threads, common, n, [n](inputs const & in)
+  {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      count += enum_strings::to_string(in.codes[i]).size();
+    }
+    bench::keep(count);
+  });
+
+  scaling("try_from_string", max_threads, common, n, [n](inputs const & in)
+  {
+    std::size_t count = 0;
+    Status s{};
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      count += enum_strings::try_from_string(in.strings[i], s) ? static_cast<std::size_t>(s) : 0;
+    }
+    bench::keep(count);
+  });
+
+  scaling("from_string", max_threads, common, n, [n](inputs const & in)
+  {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      count += static_cast<std::size_t>(enum_strings::from_string<Status>(in.strings[i]));
+    }
+    bench::keep(count);
+  });
+
+  scaling("operator<<", max_threads, common, n, [n](inputs const & in)
+  {
+    std::ostringstream os;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      os << in.codes[i] << ' ';
+    }
+    bench::keep(os.tellp());
+  });
+
+  scaling("operator>>", max_threads, common, n, [n](inputs const & in)
+  {
+    std::istringstream is(in.text);
+    std::size_t count = 0;
+    Status s{};
+    for (std::size_t i = 0; i < n && is >> s; ++i)
+    {
+      count += static_cast<std::size_t>(s);
+    }
+    bench::keep(count);
+  });
+
+  return 0;
+}
@@ -0,0 +1,94 @@
+# cmake -DNM=<nm> -DOBJDUMP=<objdump> -DOBJECT=<object file> -DBUDGETS=<budget file> [-DUPDATE=ON] -P CheckCodeSize.cmake
+#
+# Measure the size in bytes and the number of instructions of functions in <object file>
+# and compare them against <budget file>. Each non-comment line of the budget file is
+#   <symbol> <max bytes> <max instructions>
+# where <symbol> is an unmangled (extern "C") function name, whose compiler-split parts
+# such as <symbol>.cold are counted with it, or "total" for all code in the object file.
+# With UPDATE=ON the measurements are printed in the budget file format instead, to
+# start from when the budgets need to be revised.
+
+foreach(var NM OBJDUMP OBJECT BUDGETS)
+  if (NOT ${var})
+    message(FATAL_ERROR "CheckCodeSize: ${var} is not set")
+  endif()
+endforeach()
+
+# Sizes of all code symbols
+execute_process(COMMAND ${NM} -S --defined-only ${OBJECT}
+                OUTPUT_VARIABLE nm_output RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+  message(FATAL_ERROR "CheckCodeSize: ${NM} failed on ${OBJECT}")
+endif()
+string(REPLACE "\n" ";" nm_lines "${nm_output}")
+set(total_bytes 0)
+foreach(line IN LISTS nm_lines)
+  if (line MATCHES "^[0-9a-fA-F]+ ([0-9a-fA-F]+) [TtWw] ([^ ]+)$")
+    math(EXPR size "0x${CMAKE_MATCH_1}")
+    string(REGEX REPLACE "\\..*$" "" symbol "${CMAKE_MATCH_2}")
+    if (NOT DEFINED bytes_${symbol})
+      set(bytes_${symbol} 0)
+    endif()
+    math(EXPR bytes_${symbol} "${bytes_${symbol}} + ${size}")
+    math(EXPR total_bytes "${total_bytes} + ${size}")
+  endif()
+endforeach()
+
+# Instructions of all code symbols, counted from the disassembly
+execute_process(COMMAND ${OBJDUMP} -d --no-show-raw-insn ${OBJECT}
+                OUTPUT_VARIABLE objdump_output RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+  message(FATAL_ERROR "CheckCodeSize: ${OBJDUMP} failed on ${OBJECT}")
+endif()
+string(REPLACE "\n" ";" objdump_lines "${objdump_output}")
+set(total_instructions 0)
+set(symbol "")
+foreach(line IN LISTS objdump_lines)
+  if (line MATCHES "^[0-9a-fA-F]+ <([^>]+)>:$")
+    string(REGEX REPLACE "\\..*$" "" symbol "${CMAKE_MATCH_1}")
+    if (NOT DEFINED instructions_${symbol})
+      set(instructions_${symbol} 0)
+    endif()
+  elseif (symbol AND line MATCHES "^ *[0-9a-fA-F]+:\t")
+    math(EXPR instructions_${symbol} "${instructions_${symbol}} + 1")
+    math(EXPR total_instructions "${total_instructions} + 1")
+  endif()
+endforeach()
+set(bytes_total ${total_bytes})
+set(instructions_total ${total_instructions})
+
+file(STRINGS ${BUDGETS} budget_lines)
+set(report "")
+set(failures "")
+foreach(line IN LISTS budget_lines)
+  if (line MATCHES "^#" OR NOT line MATCHES "[^ ]")
+    continue()
+  endif()
+  if (NOT line MATCHES "^([^ ]+) +([0-9]+) +([0-9]+)$")
+    message(FATAL_ERROR "CheckCodeSize: malformed budget line '${line}'")
+  endif()
+  set(symbol ${CMAKE_MATCH_1})
+  set(max_bytes ${CMAKE_MATCH_2})
+  set(max_instructions ${CMAKE_MATCH_3})
+  if (NOT DEFINED bytes_${symbol})
+    list(APPEND failures "${symbol}: not found in ${OBJECT}")
+    continue()
+  endif()
+  if (UPDATE)
+    string(APPEND report "${symbol} ${bytes_${symbol}} ${instructions_${symbol}}\n")
+    continue()
+  endif()
+  string(APPEND report "${symbol}: ${bytes_${symbol}}/${max_bytes} bytes, ${instructions_${symbol}}/${max_instructions} instructions\n")
+  if (bytes_${symbol} GREATER max_bytes)
+    list(APPEND failures "${symbol}: ${bytes_${symbol}} bytes exceed the budget of ${max_bytes}")
+  endif()
+  if (instructions_${symbol} GREATER max_instructions)
+    list(APPEND failures "${symbol}: ${instructions_${symbol}} instructions exceed the budget of ${max_instructions}")
+  endif()
+endforeach()
+
+message("${report}")
+if (failures)
+  string(REPLACE ";" "\n" failures "${failures}")
+  message(FATAL_ERROR "Code size budgets exceeded:\n${failures}")
+endif()
@@ -0,0 +1,51 @@
+# enum_strings_generate(<target> <input>
+#                       ENUM <name>
+#                       [NAMESPACE <namespace>]
+#                       [OUTPUT <header>]
+#                       [FRONT_CODED [BLOCK_SIZE <entries>]])
+#
+# Generate a header with enumeration <name>, its ENUM_STRINGS registration and a
+# perfect hash lookup from the name list <input> (see tools/enum_strings_gen.cpp
+# for the format), and make it available to <target>. The header defaults to
+# <input name without extension>.h in the current binary directory, which is added
+# to the include path of <target>. With FRONT_CODED, the names are instead stored
+# front-coded for the conversions in enum_strings_compressed.h.
+#
+# The header is regenerated only when the list or the generator change, and only
+# rewritten if its contents differ, so that dependent sources are not rebuilt needlessly.
+
+set(_ENUM_STRINGS_INCLUDE_DIR ${CMAKE_CURRENT_LIST_DIR}/..)
+
+function(enum_strings_generate target input)
+  cmake_parse_arguments(ARG "FRONT_CODED" "ENUM;NAMESPACE;OUTPUT;BLOCK_SIZE" "" ${ARGN})
+  if (NOT ARG_ENUM)
+    message(FATAL_ERROR "enum_strings_generate: ENUM is required")
+  endif()
+  set(options)
+  if (ARG_FRONT_CODED AND ARG_BLOCK_SIZE)
+    set(options --front-coded=${ARG_BLOCK_SIZE})
+  elseif (ARG_FRONT_CODED)
+    set(options --front-coded)
+  endif()
+  get_filename_component(input ${input} ABSOLUTE)
+  if (NOT ARG_OUTPUT)
+    get_filename_component(name ${input} NAME_WE)
+    set(ARG_OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/${name}.h)
+  endif()
+  get_filename_component(output ${ARG_OUTPUT} ABSOLUTE BASE_DIR ${CMAKE_CURRENT_BINARY_DIR})
+  get_filename_component(output_dir ${output} DIRECTORY)
+  get_filename_component(output_name ${output} NAME)
+
+  # The stamp records when the list was last processed, independently of whether the header was rewritten
+  set(stamp ${CMAKE_CURRENT_BINARY_DIR}/CMakeFiles/${output_name}.stamp)
+  add_custom_command(OUTPUT ${stamp}
+                     BYPRODUCTS ${output}
+                     COMMAND enum_strings_gen ${options} ${input} ${output} ${ARG_ENUM} ${ARG_NAMESPACE}
+                     COMMAND ${CMAKE_COMMAND} -E touch ${stamp}
+                     DEPENDS ${input} enum_strings_gen
+                     COMMENT "Generating ${output_name} from ${input}"
+                     VERBATIM)
+  add_custom_target(${target}_${output_name}_gen DEPENDS ${stamp})
+  add_dependencies(${target} ${target}_${output_name}_gen)
+  target_include_directories(${target} PRIVATE ${output_dir} ${_ENUM_STRINGS_INCLUDE_DIR})
+endfunction()
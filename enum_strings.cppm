@@ -0,0 +1,61 @@
+/**
+ * @file enum_strings.cppm
+ * @author Sergey Klevtsov
+ *
+ * C++20 module interface of the core library (enum_strings.h). The registration
+ * macros cannot be exported from a module, so importers also include the thin
+ * enum_strings_macros.h:
+ * @code
+ * import enum_strings;
+ * #include "enum_strings_macros.h"
+ * @endcode
+ * Names in @p detail that the macros expand to are exported as well.
+ */
+
+module;
+
+#include "enum_strings.h"
+
+export module enum_strings;
+
+export namespace enum_strings
+{
+
+using ::enum_strings::num_values;
+using ::enum_strings::type_name;
+using ::enum_strings::fingerprint;
+using ::enum_strings::is_valid_code;
+using ::enum_strings::name_view;
+using ::enum_strings::to_string_view;
+using ::enum_strings::char_array;
+using ::enum_strings::joined_names;
+using ::enum_strings::max_name_length;
+using ::enum_strings::min_name_length;
+using ::enum_strings::enum_name_buffer;
+using ::enum_strings::try_from_string;
+using ::enum_strings::validate_codes;
+using ::enum_strings::convert_codes;
+using ::enum_strings::registered_enum;
+using ::enum_strings::to_string;
+using ::enum_strings::from_string;
+using ::enum_strings::get_strings;
+using ::enum_strings::numeric;
+using ::enum_strings::names;
+
+namespace detail
+{
+
+using ::enum_strings::detail::make_table;
+using ::enum_strings::detail::extern_table;
+using ::enum_strings::detail::size;
+using ::enum_strings::detail::check_num_values;
+using ::enum_strings::detail::find_string;
+using ::enum_strings::detail::stream_tag;
+using ::enum_strings::detail::registry_entry;
+using ::enum_strings::detail::describe;
+using ::enum_strings::detail::_write_enum_string;
+using ::enum_strings::detail::_read_enum_string;
+
+} // namespace detail
+
+} // namespace enum_strings
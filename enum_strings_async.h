@@ -0,0 +1,405 @@
+#ifndef ENUM_STRINGS_ASYNC_H
+#define ENUM_STRINGS_ASYNC_H
+
+/**
+ * @file enum_strings_async.h
+ * @author Sergey Klevtsov
+ *
+ * Requires C++20 and Linux (epoll).
+ */
+
+#include "enum_strings_matcher.h"
+
+#include <cerrno>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+namespace enum_strings
+{
+
+namespace async
+{
+
+/**
+ * @brief Resumes coroutines waiting for file descriptors to become readable.
+ *
+ * A loop is meant to be driven by a single thread; many coroutines, each
+ * reading its own descriptor, can share one loop.
+ */
+class event_loop
+{
+public:
+
+  event_loop()
+    : m_epfd(::epoll_create1(EPOLL_CLOEXEC))
+  {
+    if (m_epfd < 0)
+    {
+      throw std::system_error(errno, std::generic_category(), "epoll_create1");
+    }
+  }
+
+  event_loop(event_loop const &) = delete;
+  event_loop & operator=(event_loop const &) = delete;
+
+  ~event_loop()
+  {
+    ::close(m_epfd);
+  }
+
+  /**
+   * @brief Get an awaitable that suspends the caller until @p fd is readable (or closed).
+   *
+   * If the suspended coroutine is destroyed instead, its wait is cancelled: the
+   * descriptor is removed from the loop and no longer counts as waiting.
+   */
+  auto readable(int const fd)
+  {
+    struct awaiter : waiter
+    {
+      event_loop & loop;
+      int fd;
+
+      awaiter(event_loop & l, int const f) noexcept
+        : loop(l),
+          fd(f)
+      {}
+
+      awaiter(awaiter const &) = delete;
+      awaiter & operator=(awaiter const &) = delete;
+
+      ~awaiter()
+      {
+        if (pending)
+        {
+          loop.cancel(*this, fd);
+        }
+      }
+
+      bool await_ready() const noexcept { return false; }
+
+      void await_suspend(std::coroutine_handle<> const h)
+      {
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLONESHOT;
+        ev.data.ptr = static_cast<waiter *>(this);
+        if (::epoll_ctl(loop.m_epfd, EPOLL_CTL_MOD, fd, &ev) < 0)
+        {
+          if (errno != ENOENT || ::epoll_ctl(loop.m_epfd, EPOLL_CTL_ADD, fd, &ev) < 0)
+          {
+            throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+          }
+        }
+        handle = h;
+        pending = true;
+        ++loop.m_waiting;
+      }
+
+      void await_resume() const noexcept {}
+    };
+    return awaiter{ *this, fd };
+  }
+
+  /**
+   * @brief Stop watching @p fd, e.g. at end of input or before closing it.
+   *
+   * Must not be called while a coroutine waits for @p fd.
+   */
+  void remove(int const fd) noexcept
+  {
+    ::epoll_ctl(m_epfd, EPOLL_CTL_DEL, fd, nullptr);
+  }
+
+  /**
+   * @brief Wait for events once and resume the coroutines that are ready.
+   * @param timeout_ms maximum time to wait, -1 to wait indefinitely
+   * @return the number of coroutines resumed
+   */
+  std::size_t run_once(int const timeout_ms = -1)
+  {
+    int const n = ::epoll_wait(m_epfd, m_events, max_events, timeout_ms);
+    if (n < 0)
+    {
+      if (errno == EINTR) return 0;
+      throw std::system_error(errno, std::generic_category(), "epoll_wait");
+    }
+    std::size_t resumed = 0;
+    m_num_events = n;
+    for (m_next_event = 0; m_next_event < m_num_events;)
+    {
+      // Cleared if the waiting coroutine was destroyed by one resumed before it
+      void * const ptr = m_events[m_next_event++].data.ptr;
+      if (ptr != nullptr)
+      {
+        waiter & w = *static_cast<waiter *>(ptr);
+        w.pending = false;
+        --m_waiting;
+        ++resumed;
+        w.handle.resume();
+      }
+    }
+    m_num_events = 0;
+    return resumed;
+  }
+
+  /**
+   * @brief Resume coroutines until none of them is waiting.
+   */
+  void run()
+  {
+    while (m_waiting > 0)
+    {
+      run_once();
+    }
+  }
+
+  /**
+   * @return the number of coroutines currently waiting
+   */
+  std::size_t waiting() const noexcept
+  {
+    return m_waiting;
+  }
+
+private:
+
+  /// State of a coroutine suspended in readable(), pointed to by its epoll registration
+  struct waiter
+  {
+    std::coroutine_handle<> handle;
+    bool pending = false;
+  };
+
+  void cancel(waiter & w, int const fd) noexcept
+  {
+    remove(fd);
+    w.pending = false;
+    --m_waiting;
+    for (int i = m_next_event; i < m_num_events; ++i)
+    {
+      if (m_events[i].data.ptr == &w)
+      {
+        m_events[i].data.ptr = nullptr;
+      }
+    }
+  }
+
+  static constexpr int max_events = 64;
+
+  int m_epfd;
+  std::size_t m_waiting = 0;
+  epoll_event m_events[max_events];
+  int m_num_events = 0;
+  int m_next_event = 0;
+};
+
+/**
+ * @brief A coroutine that produces values asynchronously, one per @p co_await next().
+ * @tparam T type of values
+ *
+ * The generator body runs only while a consumer awaits next(); when it
+ * suspends on I/O, control goes back to whoever resumed the consumer
+ * (typically the event loop).
+ */
+template <typename T>
+class async_generator
+{
+public:
+
+  struct promise_type
+  {
+    std::optional<T> value;
+    std::coroutine_handle<> consumer;
+    std::exception_ptr error;
+
+    struct transfer_to_consumer
+    {
+      bool await_ready() const noexcept { return false; }
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> const h) noexcept { return h.promise().consumer; }
+      void await_resume() const noexcept {}
+    };
+
+    async_generator get_return_object() { return async_generator{ std::coroutine_handle<promise_type>::from_promise(*this) }; }
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    transfer_to_consumer final_suspend() const noexcept { return {}; }
+    transfer_to_consumer yield_value(T v) { value = std::move(v); return {}; }
+    void return_void() const noexcept {}
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+  };
+
+  async_generator(async_generator && other) noexcept
+    : m_handle(std::exchange(other.m_handle, {}))
+  {}
+
+  async_generator(async_generator const &) = delete;
+  async_generator & operator=(async_generator const &) = delete;
+
+  ~async_generator()
+  {
+    if (m_handle) m_handle.destroy();
+  }
+
+  /**
+   * @brief Get an awaitable producing the next value, or @p std::nullopt when the generator is finished.
+   *
+   * Rethrows any exception that escaped the generator body.
+   */
+  auto next()
+  {
+    struct awaiter
+    {
+      std::coroutine_handle<promise_type> h;
+
+      bool await_ready() const noexcept { return h.done(); }
+
+      std::coroutine_handle<> await_suspend(std::coroutine_handle<> const consumer) noexcept
+      {
+        h.promise().consumer = consumer;
+        h.promise().value.reset();
+        return h;
+      }
+
+      std::optional<T> await_resume()
+      {
+        if (h.promise().error)
+        {
+          std::rethrow_exception(std::exchange(h.promise().error, {}));
+        }
+        return h.done() ? std::nullopt : std::move(h.promise().value);
+      }
+    };
+    return awaiter{ m_handle };
+  }
+
+private:
+
+  explicit async_generator(std::coroutine_handle<promise_type> const h)
+    : m_handle(h)
+  {}
+
+  std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * @brief A coroutine that starts immediately and is not awaited by anyone.
+ *
+ * Exceptions escaping the body terminate the program, so consumers should handle them inside.
+ */
+struct detached_task
+{
+  struct promise_type
+  {
+    detached_task get_return_object() const noexcept { return {}; }
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+    std::suspend_never final_suspend() const noexcept { return {}; }
+    void return_void() const noexcept {}
+    void unhandled_exception() const noexcept { std::terminate(); }
+  };
+};
+
+/**
+ * @brief Parse whitespace-separated enum names from a file descriptor as they arrive.
+ * @tparam E type of enumeration
+ * @param loop the event loop to wait on when no input is available
+ * @param fd the file descriptor to read from, switched to non-blocking mode
+ * @return a generator of parsed values, finished at end of input
+ *
+ * Tokens are matched incrementally with enum_matcher, so a name split across
+ * several reads is recognized without being copied. A token that is not
+ * a name makes the generator throw std::invalid_argument (reporting its
+ * byte offset); read errors are thrown as std::system_error.
+ */
+template <typename E>
+async_generator<E> parse_enum_stream(event_loop & loop, int const fd)
+{
+  int const flags = ::fcntl(fd, F_GETFL);
+  if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+  {
+    throw std::system_error(errno, std::generic_category(), "fcntl");
+  }
+
+  // The descriptor stays registered between reads; drop it however the generator ends
+  struct registration
+  {
+    event_loop & loop;
+    int fd;
+    ~registration() { loop.remove(fd); }
+  } const registered{ loop, fd };
+
+  ::enum_strings::enum_matcher<E> matcher;
+  bool in_token = false;
+  std::size_t offset = 0;
+  std::size_t token_offset = 0;
+  char buffer[4096];
+
+  auto const finish_token = [&](E & e)
+  {
+    in_token = false;
+    if (!matcher.match(e))
+    {
+      throw std::invalid_argument("Token at byte " + std::to_string(token_offset) + " is not a valid string representation of this type");
+    }
+  };
+
+  while (true)
+  {
+    ssize_t const n = ::read(fd, buffer, sizeof(buffer));
+    if (n < 0)
+    {
+      if (errno == EINTR) continue;
+      if (errno != EAGAIN && errno != EWOULDBLOCK)
+      {
+        throw std::system_error(errno, std::generic_category(), "read");
+      }
+      co_await loop.readable(fd);
+      continue;
+    }
+    if (n == 0)
+    {
+      break;
+    }
+    for (ssize_t i = 0; i < n; ++i, ++offset)
+    {
+      char const c = buffer[i];
+      bool const space = c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+      if (space)
+      {
+        if (in_token)
+        {
+          E e{};
+          finish_token(e);
+          co_yield e;
+        }
+      }
+      else
+      {
+        if (!in_token)
+        {
+          in_token = true;
+          token_offset = offset;
+          matcher.reset();
+        }
+        matcher.feed(c);
+      }
+    }
+  }
+  if (in_token)
+  {
+    E e{};
+    finish_token(e);
+    co_yield e;
+  }
+}
+
+} // namespace async
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_ASYNC_H
@@ -0,0 +1,156 @@
+#ifndef ENUM_STRINGS_ATOMIC_SET_H
+#define ENUM_STRINGS_ATOMIC_SET_H
+
+/**
+ * @file enum_strings_atomic_set.h
+ * @author Sergey Klevtsov
+ */
+
+#include "enum_strings_set.h"
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+namespace enum_strings
+{
+
+/**
+ * @brief A fixed-size bit set of enumeration values that threads update concurrently.
+ * @tparam E type of enumeration
+ *
+ * Storage is sized from num_values<E>() at compile time, one bit per value, in atomic
+ * words each padded to its own cache line, so threads updating values of different
+ * words do not slow each other down. insert(), erase() and contains() are a single
+ * @p fetch_or, @p fetch_and or load: they never block and never retry.
+ *
+ * Operations on several values (snapshot(), clear()) are atomic word by word only.
+ * The alignment exceeds that of @p new before C++17, so allocate sets statically
+ * or as members of objects with suitable alignment.
+ */
+template <typename E>
+class atomic_enum_set
+{
+public:
+
+  using word_type = typename ::enum_strings::enum_set<E>::word_type;
+
+  static constexpr std::size_t bits_per_word = ::enum_strings::enum_set<E>::bits_per_word;
+  static constexpr std::size_t num_words = ::enum_strings::enum_set<E>::num_words;
+
+  /// Size the words are padded to
+  static constexpr std::size_t cache_line = 64;
+
+  static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "64-bit atomic operations must be lock-free");
+
+  atomic_enum_set() noexcept = default;
+
+  explicit atomic_enum_set(::enum_strings::enum_set<E> const & values) noexcept
+  {
+    for (std::size_t i = 0; i < num_words; ++i)
+    {
+      m_words[i].value.store(values.words()[i], std::memory_order_relaxed);
+    }
+  }
+
+  atomic_enum_set(atomic_enum_set const &) = delete;
+  atomic_enum_set & operator=(atomic_enum_set const &) = delete;
+
+  /**
+   * @brief Add a value to the set.
+   * @param e the value to add (must be in the registered range)
+   * @param order memory ordering of the update
+   * @return @p true if the value was not in the set before
+   */
+  bool insert(E const e, std::memory_order const order = std::memory_order_seq_cst) noexcept
+  {
+    auto const i = index(e);
+    word_type const bit = word_type{1} << (i % bits_per_word);
+    return (m_words[i / bits_per_word].value.fetch_or(bit, order) & bit) == 0;
+  }
+
+  /**
+   * @brief Remove a value from the set.
+   * @param e the value to remove (must be in the registered range)
+   * @param order memory ordering of the update
+   * @return @p true if the value was in the set before
+   */
+  bool erase(E const e, std::memory_order const order = std::memory_order_seq_cst) noexcept
+  {
+    auto const i = index(e);
+    word_type const bit = word_type{1} << (i % bits_per_word);
+    return (m_words[i / bits_per_word].value.fetch_and(~bit, order) & bit) != 0;
+  }
+
+  /**
+   * @brief Check whether a value is in the set.
+   * @param e the value to check (must be in the registered range)
+   * @param order memory ordering of the load
+   * @return @p true if the value is in the set
+   */
+  bool contains(E const e, std::memory_order const order = std::memory_order_seq_cst) const noexcept
+  {
+    auto const i = index(e);
+    return (m_words[i / bits_per_word].value.load(order) >> (i % bits_per_word)) & 1;
+  }
+
+  /**
+   * @brief Copy the current contents, loading each word once.
+   * @param order memory ordering of the loads
+   * @return the values in the set
+   */
+  ::enum_strings::enum_set<E> snapshot(std::memory_order const order = std::memory_order_seq_cst) const noexcept
+  {
+    ::enum_strings::enum_set<E> result;
+    for (std::size_t i = 0; i < num_words; ++i)
+    {
+      result.words()[i] = m_words[i].value.load(order);
+    }
+    return result;
+  }
+
+  /**
+   * @brief Remove all values.
+   * @param order memory ordering of the stores
+   */
+  void clear(std::memory_order const order = std::memory_order_seq_cst) noexcept
+  {
+    for (std::size_t i = 0; i < num_words; ++i)
+    {
+      m_words[i].value.store(0, order);
+    }
+  }
+
+  /**
+   * @brief Write the names of the values in the set, in ascending order, separated by '|'.
+   */
+  template <typename C, typename T>
+  friend std::basic_ostream<C, T> & operator<<(std::basic_ostream<C, T> & os, atomic_enum_set const & set)
+  {
+    char const * separator = "";
+    set.snapshot().for_each([&](E const e)
+    {
+      os << separator << ::enum_strings::to_string_view(e).data();
+      separator = "|";
+    });
+    return os;
+  }
+
+private:
+
+  static std::size_t index(E const e) noexcept
+  {
+    return static_cast<std::size_t>(static_cast<std::underlying_type_t<E>>(e));
+  }
+
+  struct alignas(cache_line) padded_word
+  {
+    std::atomic<word_type> value{ 0 };
+  };
+
+  padded_word m_words[num_words == 0 ? 1 : num_words];
+};
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_ATOMIC_SET_H
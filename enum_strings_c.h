@@ -0,0 +1,199 @@
+#ifndef ENUM_STRINGS_C_H
+#define ENUM_STRINGS_C_H
+
+/**
+ * @file enum_strings_c.h
+ * @author Sergey Klevtsov
+ *
+ * C interface for converting whole arrays of registered enum values, e.g. from
+ * foreign function interfaces where a call per element is too expensive.
+ * This header is valid C99 as well as C++. A C++ translation unit exports an
+ * enumeration with ENUM_STRINGS_EXPORT_C, which defines extern "C" functions
+ * converting arrays in a single call, plus one returning its descriptor:
+ * @code
+ * // colors.cpp
+ * #include "enum_strings_c.h"
+ * ENUM_STRINGS_EXPORT_C(app::Color, app_color)
+ *
+ * // user.c (or ctypes, Rust FFI, ... loading the library)
+ * ENUM_STRINGS_DECLARE_C(app_color);
+ * size_t const done = app_color_decode(codes, n, buf, sizeof(buf), offsets);
+ * @endcode
+ * Strings are passed as characters stored back to back with an array of n + 1
+ * offsets, string i occupying <tt>[offsets[i], offsets[i + 1])</tt>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Write the names of an array of codes back to back.
+ * @param codes the codes to convert
+ * @param n number of codes
+ * @param out output characters (not null-terminated)
+ * @param capacity size of @p out
+ * @param offsets output array of n + 1 offsets of the names in @p out
+ * @return number of codes converted: n, or the position of the first invalid code
+ *         or of the first name that does not fit; offsets are written up to it
+ */
+typedef size_t (* enum_strings_decode_function)(int32_t const * codes, size_t n, char * out, size_t capacity, size_t * offsets);
+
+/**
+ * Convert an array of length-delimited strings to codes.
+ * @param chars characters of all strings
+ * @param offsets array of n + 1 offsets of the strings in @p chars
+ * @param n number of strings
+ * @param codes output array of n codes
+ * @return number of strings converted: n, or the position of the first string that is not a name
+ */
+typedef size_t (* enum_strings_encode_function)(char const * chars, size_t const * offsets, size_t n, int32_t * codes);
+
+/** Description of a registered enumeration */
+typedef struct enum_strings_descriptor
+{
+  char const * type_name;              /**< name of the type, as written in the registration */
+  size_t count;                        /**< number of values, with codes 0..count-1 */
+  char const * const * names;          /**< null-terminated name of each value */
+  size_t const * lengths;              /**< length of each name */
+  uint64_t fingerprint;                /**< hash of the type name and all names, see enum_strings::fingerprint */
+  enum_strings_decode_function decode; /**< the exported <prefix>_decode */
+  enum_strings_encode_function encode; /**< the exported <prefix>_encode */
+} enum_strings_descriptor;
+
+/** Write the names of an array of codes back to back, see enum_strings_decode_function */
+static inline size_t enum_strings_decode(enum_strings_descriptor const * const d, int32_t const * const codes, size_t const n,
+                                         char * const out, size_t const capacity, size_t * const offsets)
+{
+  return d->decode(codes, n, out, capacity, offsets);
+}
+
+/** Convert an array of length-delimited strings to codes, see enum_strings_encode_function */
+static inline size_t enum_strings_encode(enum_strings_descriptor const * const d, char const * const chars, size_t const * const offsets,
+                                         size_t const n, int32_t * const codes)
+{
+  return d->encode(chars, offsets, n, codes);
+}
+
+/**
+ * Declare the functions defined by ENUM_STRINGS_EXPORT_C(ENUM, PREFIX), for use from C.
+ */
+#define ENUM_STRINGS_DECLARE_C(PREFIX)                                                                   \
+  size_t PREFIX##_decode(int32_t const * codes, size_t n, char * out, size_t capacity, size_t * offsets); \
+  size_t PREFIX##_encode(char const * chars, size_t const * offsets, size_t n, int32_t * codes);          \
+  enum_strings_descriptor const * PREFIX##_descriptor(void)
+
+#ifdef __cplusplus
+} // extern "C"
+
+#include "enum_strings_core.h"
+
+namespace enum_strings
+{
+
+namespace detail
+{
+
+/// Implementation of <prefix>_decode
+template <typename E>
+inline std::size_t c_decode(std::int32_t const * const codes, std::size_t const n,
+                            char * const out, std::size_t const capacity, std::size_t * const offsets) noexcept
+{
+  auto const & strings = ::enum_strings::detail::get_strings<E>();
+  auto const & lengths = ::enum_strings::detail::get_lengths<E>();
+  std::size_t const count = ::enum_strings::num_values<E>();
+  std::size_t pos = 0;
+  offsets[0] = 0;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    if (codes[i] < 0 || static_cast<std::size_t>(codes[i]) >= count)
+    {
+      return i;
+    }
+    std::size_t const length = lengths[codes[i]];
+    if (length > capacity - pos)
+    {
+      return i;
+    }
+    std::memcpy(out + pos, strings[codes[i]], length);
+    pos += length;
+    offsets[i + 1] = pos;
+  }
+  return n;
+}
+
+/// Implementation of <prefix>_encode
+template <typename E>
+inline std::size_t c_encode(char const * const chars, std::size_t const * const offsets, std::size_t const n,
+                            std::int32_t * const codes) noexcept
+{
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    E e{};
+    if (!::enum_strings::try_from_string(chars + offsets[i], offsets[i + 1] - offsets[i], e))
+    {
+      return i;
+    }
+    codes[i] = static_cast<std::int32_t>(e);
+  }
+  return n;
+}
+
+} // namespace detail
+
+} // namespace enum_strings
+
+#if defined(_WIN32)
+#define ENUM_STRINGS_C_EXPORT __declspec(dllexport)
+#elif defined(__GNUC__)
+#define ENUM_STRINGS_C_EXPORT __attribute__((visibility("default")))
+#else
+#define ENUM_STRINGS_C_EXPORT
+#endif
+
+/**
+ * @brief Define and export the C functions of @p ENUM, named after @p PREFIX:
+ *  - <tt>size_t PREFIX_decode(int32_t const * codes, size_t n, char * out, size_t capacity, size_t * offsets)</tt>
+ *  - <tt>size_t PREFIX_encode(char const * chars, size_t const * offsets, size_t n, int32_t * codes)</tt>
+ *  - <tt>enum_strings_descriptor const * PREFIX_descriptor(void)</tt>
+ *
+ * The loops run in C++, so a foreign caller crosses the language boundary once per array.
+ * The functions are exported from shared libraries even when symbols are hidden by default.
+ * Use at global scope, in one C++ translation unit per enumeration and prefix.
+ */
+#define ENUM_STRINGS_EXPORT_C(ENUM, PREFIX)                                                                   \
+extern "C" ENUM_STRINGS_C_EXPORT size_t PREFIX##_decode(int32_t const * const codes, size_t const n,          \
+                                                        char * const out, size_t const capacity,              \
+                                                        size_t * const offsets)                               \
+{                                                                                                             \
+  return ::enum_strings::detail::c_decode<ENUM>(codes, n, out, capacity, offsets);                            \
+}                                                                                                             \
+                                                                                                              \
+extern "C" ENUM_STRINGS_C_EXPORT size_t PREFIX##_encode(char const * const chars, size_t const * const offsets, \
+                                                        size_t const n, int32_t * const codes)                \
+{                                                                                                             \
+  return ::enum_strings::detail::c_encode<ENUM>(chars, offsets, n, codes);                                    \
+}                                                                                                             \
+                                                                                                              \
+extern "C" ENUM_STRINGS_C_EXPORT enum_strings_descriptor const * PREFIX##_descriptor(void)                    \
+{                                                                                                             \
+  static enum_strings_descriptor const descriptor =                                                           \
+  {                                                                                                           \
+    ::enum_strings::type_name<ENUM>(),                                                                        \
+    ::enum_strings::num_values<ENUM>(),                                                                       \
+    ::enum_strings::detail::get_strings<ENUM>(),                                                              \
+    ::enum_strings::detail::get_lengths<ENUM>(),                                                              \
+    ::enum_strings::fingerprint<ENUM>(),                                                                      \
+    &PREFIX##_decode,                                                                                         \
+    &PREFIX##_encode                                                                                          \
+  };                                                                                                          \
+  return &descriptor;                                                                                         \
+}
+
+#endif // __cplusplus
+
+#endif //ENUM_STRINGS_C_H
@@ -0,0 +1,257 @@
+#ifndef ENUM_STRINGS_COMPRESSED_H
+#define ENUM_STRINGS_COMPRESSED_H
+
+/**
+ * @file enum_strings_compressed.h
+ * @author Sergey Klevtsov
+ */
+
+#include "enum_strings_string.h"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace enum_strings
+{
+
+/**
+ * @brief Conversions of very large enumerations whose names are stored front-coded.
+ *
+ * Such enumerations are not registered with ENUM_STRINGS: enum_strings_gen --front-coded
+ * generates the table and the @p _get_front_coded_names(E) hook that finds it. Names and
+ * aliases are sorted and split into blocks; the first name of a block is stored whole and
+ * every other one as the length of the prefix it shares with the previous name plus the
+ * remaining characters, so names with long common prefixes take a fraction of their size.
+ * A name is decoded by walking its block from the head; a string is looked up by a
+ * binary search over the block heads followed by a walk of one block.
+ */
+namespace compressed
+{
+
+/**
+ * @brief Front-coded names of an enumeration.
+ *
+ * Each entry of a block is a prefix length byte, a suffix length byte and the suffix;
+ * the first entry of a block has a prefix length of 0.
+ */
+struct front_coded_table
+{
+  std::size_t count;                   ///< number of values
+  std::size_t entries;                 ///< number of names and aliases
+  std::size_t block_size;              ///< entries per block
+  std::size_t max_length;              ///< length of the longest name or alias
+  std::size_t data_size;               ///< size of @p data in bytes
+  char const * data;                   ///< all blocks
+  std::uint32_t const * block_offsets; ///< offset of each block in @p data
+  std::uint32_t const * ranks;         ///< position of the name of each value in sorted order
+  std::uint32_t const * values;        ///< value of each entry in sorted order
+
+  /// Total number of bytes taken by the table and its arrays
+  std::size_t memory_usage() const noexcept
+  {
+    std::size_t const blocks = (entries + block_size - 1) / block_size;
+    return sizeof(*this) + data_size + (blocks + count + entries) * sizeof(std::uint32_t);
+  }
+};
+
+/// Longest name or alias that can be stored in a table
+constexpr std::size_t max_stored_length = 255;
+
+namespace detail
+{
+
+/**
+ * @brief Decode entry @p pos of a table.
+ * @param buf output buffer of at least @p table.max_length characters
+ * @return the length of the entry
+ */
+inline std::size_t decode(front_coded_table const & table, std::size_t const pos, char * const buf) noexcept
+{
+  std::size_t const block = pos / table.block_size;
+  char const * p = table.data + table.block_offsets[block];
+  for (std::size_t i = block * table.block_size; ; ++i)
+  {
+    std::size_t const prefix = static_cast<unsigned char>(p[0]);
+    std::size_t const suffix = static_cast<unsigned char>(p[1]);
+    std::memcpy(buf + prefix, p + 2, suffix);
+    if (i == pos)
+    {
+      return prefix + suffix;
+    }
+    p += 2 + suffix;
+  }
+}
+
+/// Three-way comparison of two strings, ordered as by std::string
+inline int compare(char const * const a, std::size_t const a_length, char const * const b, std::size_t const b_length) noexcept
+{
+  int const c = std::memcmp(a, b, a_length < b_length ? a_length : b_length);
+  return c != 0 ? c : (a_length < b_length ? -1 : a_length > b_length ? 1 : 0);
+}
+
+/**
+ * @brief Find a string among the entries of a table.
+ * @return the position of the entry, or @p table.entries if not found
+ */
+inline std::size_t find(front_coded_table const & table, char const * const s, std::size_t const length) noexcept
+{
+  if (length > table.max_length)
+  {
+    return table.entries;
+  }
+
+  // Last block whose head is not greater than s
+  std::size_t const blocks = (table.entries + table.block_size - 1) / table.block_size;
+  std::size_t lo = 0;
+  std::size_t hi = blocks;
+  while (hi - lo > 1)
+  {
+    std::size_t const mid = lo + (hi - lo) / 2;
+    char const * const head = table.data + table.block_offsets[mid];
+    if (compare(head + 2, static_cast<unsigned char>(head[1]), s, length) <= 0)
+    {
+      lo = mid;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  char buf[max_stored_length];
+  std::size_t const end = (lo + 1) * table.block_size < table.entries ? (lo + 1) * table.block_size : table.entries;
+  char const * p = table.data + table.block_offsets[lo];
+  for (std::size_t i = lo * table.block_size; i < end; ++i)
+  {
+    std::size_t const prefix = static_cast<unsigned char>(p[0]);
+    std::size_t const suffix = static_cast<unsigned char>(p[1]);
+    std::memcpy(buf + prefix, p + 2, suffix);
+    p += 2 + suffix;
+    int const c = compare(buf, prefix + suffix, s, length);
+    if (c == 0)
+    {
+      return i;
+    }
+    if (c > 0)
+    {
+      break;
+    }
+  }
+  return table.entries;
+}
+
+template <typename E>
+inline front_coded_table const & get_table() noexcept
+{
+  return _get_front_coded_names(E{});
+}
+
+} // namespace detail
+
+/**
+ * @brief Get the number of values of an enum type with front-coded names.
+ */
+template <typename E>
+inline std::size_t num_values() noexcept
+{
+  return ::enum_strings::compressed::detail::get_table<E>().count;
+}
+
+/**
+ * @brief Get the length of the longest name (or alias) of an enum type with front-coded names.
+ */
+template <typename E>
+inline std::size_t max_name_length() noexcept
+{
+  return ::enum_strings::compressed::detail::get_table<E>().max_length;
+}
+
+/**
+ * @brief Decode the name of an enum value into a caller-provided buffer.
+ * @tparam E type of enumeration
+ * @param e the enum value to convert
+ * @param buf output buffer of at least max_name_length<E>() characters (not null-terminated)
+ * @return the length of the name, or 0 if @p e is out of range
+ */
+template <typename E>
+inline std::size_t to_string(E const e, char * const buf) noexcept
+{
+  auto const & table = ::enum_strings::compressed::detail::get_table<E>();
+  auto const index = static_cast<std::make_unsigned_t<std::underlying_type_t<E>>>(e);
+  if (index >= table.count)
+  {
+    return 0;
+  }
+  return ::enum_strings::compressed::detail::decode(table, table.ranks[index], buf);
+}
+
+/**
+ * @brief Convert enum to string.
+ * @tparam E type of enumeration
+ * @param e the enum value to convert
+ * @return the corresponding string
+ * @exception std::invalid_argument if numerical value of @p e is negative or greater of equal than the number of values.
+ */
+template <typename E>
+inline std::string to_string(E const e)
+{
+  char buf[max_stored_length];
+  std::size_t const length = ::enum_strings::compressed::to_string(e, buf);
+  if (length == 0)
+  {
+    ::enum_strings::detail::message_buffer msg;
+    msg << "Invalid value " << static_cast<std::underlying_type_t<E>>(e)
+        << ". Valid range is 0.." << (::enum_strings::compressed::num_values<E>() - 1);
+    throw std::invalid_argument(msg.c_str());
+  }
+  return std::string(buf, length);
+}
+
+/**
+ * @brief Convert string to enum without throwing or allocating.
+ * @tparam E type of enumeration
+ * @param s pointer to the characters of the string (need not be null-terminated)
+ * @param length number of characters
+ * @param e the value to assign if the string is found
+ * @return @p true if @p s is a name or alias of given enum type, in which case @p e is assigned
+ */
+template <typename E>
+inline bool try_from_string(char const * const s, std::size_t const length, E & e) noexcept
+{
+  auto const & table = ::enum_strings::compressed::detail::get_table<E>();
+  std::size_t const pos = ::enum_strings::compressed::detail::find(table, s, length);
+  if (pos == table.entries)
+  {
+    return false;
+  }
+  e = static_cast<E>(table.values[pos]);
+  return true;
+}
+
+/**
+ * @brief Convert string to enum
+ * @tparam E type of enumeration
+ * @param s the string to convert
+ * @return the corresponding enum value
+ * @exception std::invalid_argument if @p s is not a name or alias of given enum type
+ */
+template <typename E>
+inline E from_string(std::string const & s)
+{
+  E e{};
+  if (!::enum_strings::compressed::try_from_string(s.data(), s.size(), e))
+  {
+    ::enum_strings::detail::message_buffer msg;
+    msg.append_quoted(s.data(), s.size()) << " is not a valid string representation of this type";
+    throw std::invalid_argument(msg.c_str());
+  }
+  return e;
+}
+
+} // namespace compressed
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_COMPRESSED_H
@@ -0,0 +1,334 @@
+#ifndef ENUM_STRINGS_CONFIG_H
+#define ENUM_STRINGS_CONFIG_H
+
+/**
+ * @file enum_strings_config.h
+ * @author Sergey Klevtsov
+ */
+
+#include "enum_strings.h"
+#include "enum_strings_set.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <system_error>
+#endif
+
+namespace enum_strings
+{
+
+/**
+ * @brief Error in configuration text, with the position where it was detected.
+ */
+class config_error : public std::runtime_error
+{
+public:
+
+  config_error(std::size_t const line, std::size_t const column, std::string const & what)
+    : std::runtime_error(std::to_string(line) + ":" + std::to_string(column) + ": " + what),
+      m_line(line),
+      m_column(column)
+  {}
+
+  /// 1-based line number
+  std::size_t line() const noexcept { return m_line; }
+
+  /// 1-based column number
+  std::size_t column() const noexcept { return m_column; }
+
+private:
+
+  std::size_t m_line;
+  std::size_t m_column;
+};
+
+/**
+ * @brief Parser of configuration values of a given type.
+ * @tparam T type of value
+ *
+ * Specialize to support other types. @p parse receives the value text
+ * (trimmed, not null-terminated) and returns @p false if it is invalid.
+ */
+template <typename T, typename = void>
+struct config_value_parser;
+
+template <typename T>
+struct config_value_parser<T, std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value>>
+{
+  static bool parse(char const * s, std::size_t n, T & value) noexcept
+  {
+    bool const negative = std::is_signed<T>::value && n > 0 && s[0] == '-';
+    if (n > 0 && (s[0] == '-' || s[0] == '+'))
+    {
+      if (s[0] == '-' && !negative) return false;
+      ++s;
+      --n;
+    }
+    if (n == 0) return false;
+    using U = std::make_unsigned_t<T>;
+    U const limit = negative ? static_cast<U>(U(std::numeric_limits<T>::max()) + 1) : U(std::numeric_limits<T>::max());
+    U result = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if (s[i] < '0' || s[i] > '9') return false;
+      U const digit = static_cast<U>(s[i] - '0');
+      if (result > (limit - digit) / 10) return false;
+      result = static_cast<U>(result * 10 + digit);
+    }
+    value = negative ? static_cast<T>(0 - result) : static_cast<T>(result);
+    return true;
+  }
+};
+
+template <typename T>
+struct config_value_parser<T, std::enable_if_t<std::is_floating_point<T>::value>>
+{
+  static bool parse(char const * const s, std::size_t const n, T & value) noexcept
+  {
+    char buf[64];
+    if (n == 0 || n >= sizeof(buf)) return false;
+    std::memcpy(buf, s, n);
+    buf[n] = '\0';
+    char * end;
+    errno = 0;
+    double const result = std::strtod(buf, &end);
+    if (end != buf + n || errno == ERANGE) return false;
+    value = static_cast<T>(result);
+    return true;
+  }
+};
+
+template <>
+struct config_value_parser<bool>
+{
+  static bool parse(char const * const s, std::size_t const n, bool & value) noexcept
+  {
+    if (n == 4 && std::memcmp(s, "true", 4) == 0) { value = true; return true; }
+    if (n == 5 && std::memcmp(s, "false", 5) == 0) { value = false; return true; }
+    return false;
+  }
+};
+
+template <>
+struct config_value_parser<std::string>
+{
+  static bool parse(char const * const s, std::size_t const n, std::string & value)
+  {
+    value.assign(s, n);
+    return true;
+  }
+};
+
+/// Registered enumerations are parsed by name
+template <typename T>
+struct config_value_parser<T, std::enable_if_t<std::is_enum<T>::value>>
+{
+  static bool parse(char const * const s, std::size_t const n, T & value) noexcept
+  {
+    return ::enum_strings::try_from_string(s, n, value);
+  }
+};
+
+/**
+ * @brief A configuration with an enumeration as the key schema.
+ * @tparam K type of enumeration whose names are the keys
+ * @tparam Ts types of values, one per key in the order of enumeration values
+ *
+ * Values are stored densely, indexed by key, without any per-entry allocation.
+ * The text format is one <tt>key = value</tt> per line; blank lines and lines
+ * starting with @p # are ignored. A later assignment of a key overrides an earlier one.
+ */
+template <typename K, typename ... Ts>
+class enum_config
+{
+  static_assert(sizeof...(Ts) == ::enum_strings::num_values<K>(), "Number of value types doesn't match number of keys");
+
+public:
+
+  template <K key>
+  using value_type = std::tuple_element_t<static_cast<std::size_t>(key), std::tuple<Ts...>>;
+
+  /**
+   * @brief Get the value of a key.
+   * @return the parsed or assigned value, or a default-constructed one if the key was not set
+   */
+  template <K key>
+  value_type<key> const & get() const noexcept
+  {
+    return std::get<static_cast<std::size_t>(key)>(m_values);
+  }
+
+  /**
+   * @brief Assign the value of a key (e.g. to provide a default before parsing).
+   */
+  template <K key>
+  void set(value_type<key> value)
+  {
+    std::get<static_cast<std::size_t>(key)>(m_values) = std::move(value);
+    m_keys.insert(key);
+  }
+
+  /**
+   * @return @p true if the key was parsed or assigned
+   */
+  bool contains(K const key) const noexcept
+  {
+    return m_keys.contains(key);
+  }
+
+  /**
+   * @return the set of keys that were parsed or assigned
+   */
+  ::enum_strings::enum_set<K> const & keys() const noexcept
+  {
+    return m_keys;
+  }
+
+  /**
+   * @brief Parse configuration text in one pass, without copying it.
+   * @param data pointer to the text
+   * @param size size of the text in bytes
+   * @exception config_error on unknown keys, malformed lines or invalid values
+   */
+  void parse(char const * const data, std::size_t const size)
+  {
+    char const * const end = data + size;
+    std::size_t line = 1;
+    for (char const * p = data; p < end; ++line)
+    {
+      char const * const line_begin = p;
+      char const * line_end = static_cast<char const *>(std::memchr(p, '\n', static_cast<std::size_t>(end - p)));
+      line_end = line_end ? line_end : end;
+      p = line_end == end ? end : line_end + 1;
+
+      auto const column = [line_begin](char const * const q) { return static_cast<std::size_t>(q - line_begin) + 1; };
+
+      char const * q = skip_space(line_begin, line_end);
+      if (q == line_end || *q == '#') continue;
+
+      char const * const key_begin = q;
+      for (; q < line_end && *q != '=' && !is_space(*q); ++q);
+      char const * const key_end = q;
+
+      K key{};
+      if (!::enum_strings::try_from_string(key_begin, static_cast<std::size_t>(key_end - key_begin), key))
+      {
+        throw config_error(line, column(key_begin), "unknown key '" + std::string(key_begin, key_end) + "'");
+      }
+
+      q = skip_space(q, line_end);
+      if (q == line_end || *q != '=')
+      {
+        throw config_error(line, column(q), "expected '=' after key '" + std::string(key_begin, key_end) + "'");
+      }
+
+      char const * const value_begin = skip_space(q + 1, line_end);
+      char const * value_end = line_end;
+      for (; value_end > value_begin && is_space(value_end[-1]); --value_end);
+
+      std::size_t const index = static_cast<std::size_t>(key);
+      if (!parsers()[index](*this, value_begin, static_cast<std::size_t>(value_end - value_begin)))
+      {
+        throw config_error(line, column(value_begin), "invalid value '" + std::string(value_begin, value_end) +
+                                                      "' for key '" + std::string(key_begin, key_end) + "'");
+      }
+      m_keys.insert(key);
+    }
+  }
+
+#if defined(__unix__) || defined(__APPLE__)
+  /**
+   * @brief Parse a configuration file, mapping it into memory instead of reading it.
+   * @param path path to the file
+   * @exception std::system_error if the file cannot be opened or mapped
+   * @exception config_error on unknown keys, malformed lines or invalid values
+   */
+  void load(char const * const path)
+  {
+    int const fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+      throw std::system_error(errno, std::generic_category(), path);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) < 0)
+    {
+      int const err = errno;
+      ::close(fd);
+      throw std::system_error(err, std::generic_category(), path);
+    }
+    std::size_t const size = static_cast<std::size_t>(st.st_size);
+    if (size == 0)
+    {
+      ::close(fd);
+      return;
+    }
+    void * const data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    int const err = errno;
+    ::close(fd);
+    if (data == MAP_FAILED)
+    {
+      throw std::system_error(err, std::generic_category(), path);
+    }
+    struct unmap
+    {
+      void * data;
+      std::size_t size;
+      ~unmap() { ::munmap(data, size); }
+    } const guard{ data, size };
+    parse(static_cast<char const *>(data), size);
+  }
+#endif
+
+private:
+
+  using parser_type = bool (*)(enum_config &, char const *, std::size_t);
+
+  template <std::size_t I>
+  static bool parse_value(enum_config & config, char const * const s, std::size_t const n)
+  {
+    using T = std::tuple_element_t<I, std::tuple<Ts...>>;
+    return ::enum_strings::config_value_parser<T>::parse(s, n, std::get<I>(config.m_values));
+  }
+
+  template <std::size_t ... I>
+  static parser_type const * parsers(std::index_sequence<I...>) noexcept
+  {
+    static parser_type const table[] = { &parse_value<I> ... };
+    return table;
+  }
+
+  static parser_type const * parsers() noexcept
+  {
+    return parsers(std::index_sequence_for<Ts...>{});
+  }
+
+  static bool is_space(char const c) noexcept
+  {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+  }
+
+  static char const * skip_space(char const * p, char const * const end) noexcept
+  {
+    for (; p < end && is_space(*p); ++p);
+    return p;
+  }
+
+  std::tuple<Ts...> m_values;
+  ::enum_strings::enum_set<K> m_keys;
+};
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_CONFIG_H
@@ -0,0 +1,659 @@
+#ifndef ENUM_STRINGS_CORE_H
+#define ENUM_STRINGS_CORE_H
+
+/**
+ * @file enum_strings_core.h
+ * @author Sergey Klevtsov
+ *
+ * Registration, lookup and allocation-free conversions, with minimal standard includes.
+ * Conversions to and from @p std::string live in enum_strings_string.h, stream operators
+ * in enum_strings_iostream.h, and enum_strings.h includes everything.
+ */
+
+#include "enum_strings_macros.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <type_traits>
+
+namespace enum_strings
+{
+
+namespace detail
+{
+
+inline constexpr std::size_t length(char const * const s)
+{
+  std::size_t n = 0;
+  for (; s[n] != '\0'; ++n);
+  return n;
+}
+
+inline constexpr std::uint64_t fnv1a(std::uint64_t const h, char const c)
+{
+  return (h ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+}
+
+/// Type name, strings associated with an enumeration and their lengths, built at compile time
+template <std::size_t N>
+struct table
+{
+  char const * type_name;
+  char const * strings[N];
+  std::size_t lengths[N];
+};
+
+template <typename ... Ts>
+inline constexpr table<sizeof...(Ts)> make_table(char const * const type_name, Ts const ... ss)
+{
+  return { type_name, { ss ... }, { ::enum_strings::detail::length(ss) ... } };
+}
+
+/// Table of an enumeration registered with ENUM_STRINGS_DECLARE, defined once by ENUM_STRINGS_DEFINE
+struct extern_table
+{
+  char const * type_name;
+  std::size_t count;
+  char const * const * strings;
+  std::size_t const * lengths;
+};
+
+template <typename E>
+using is_extern = std::is_same<std::decay_t<decltype(_get_enum_strings(E{}))>, ::enum_strings::detail::extern_table>; // invoke ADL
+
+/// Single program-wide instance of the table of each enumeration
+template <typename E>
+struct storage
+{
+  static_assert(std::is_enum<E>::value, "Not an enumeration type");
+  static_assert(!::enum_strings::detail::is_extern<E>::value, "Strings must be known at compile time (use ENUM_STRINGS)");
+  using type = decltype(_get_enum_strings(E{})); // invoke ADL
+  static constexpr type value = _get_enum_strings(E{});
+};
+
+#if __cplusplus < 201703L
+template <typename E>
+constexpr typename storage<E>::type storage<E>::value;
+#endif
+
+template <typename T>
+struct size;
+
+template <typename T, std::size_t N>
+struct size<T[N]>
+{
+  static constexpr std::size_t value = N;
+};
+
+/// Access to the table built at compile time
+template <typename E, bool = ::enum_strings::detail::is_extern<E>::value>
+struct access
+{
+  static constexpr auto const & strings() { return ::enum_strings::detail::storage<E>::value.strings; }
+  static constexpr auto const & lengths() { return ::enum_strings::detail::storage<E>::value.lengths; }
+  static constexpr char const * type_name() { return ::enum_strings::detail::storage<E>::value.type_name; }
+  static constexpr std::size_t count() { return ::enum_strings::detail::size<std::remove_const_t<decltype(::enum_strings::detail::storage<E>::value.strings)>>::value; }
+};
+
+/// Access to the table defined in another translation unit
+template <typename E>
+struct access<E, true>
+{
+  static char const * const * strings() noexcept { return _get_enum_strings(E{}).strings; }
+  static std::size_t const * lengths() noexcept { return _get_enum_strings(E{}).lengths; }
+  static char const * type_name() noexcept { return _get_enum_strings(E{}).type_name; }
+  static std::size_t count() noexcept { return _get_enum_strings(E{}).count; }
+};
+
+template<typename E>
+inline constexpr decltype(auto) get_strings()
+{
+  return ::enum_strings::detail::access<E>::strings();
+}
+
+template<typename E>
+inline constexpr decltype(auto) get_lengths()
+{
+  return ::enum_strings::detail::access<E>::lengths();
+}
+
+} // namespace detail
+
+/**
+ * @brief Get the number of enum values that are associated with strings.
+ * @tparam E type of enumeration
+ * @return the number of values
+ */
+template <typename E>
+inline constexpr std::size_t num_values()
+{
+  return ::enum_strings::detail::access<E>::count();
+}
+
+/**
+ * @brief Get the name of an enumeration type.
+ * @tparam E type of enumeration
+ * @return the type name as spelled in the ENUM_STRINGS invocation
+ */
+template <typename E>
+inline constexpr char const * type_name()
+{
+  return ::enum_strings::detail::access<E>::type_name();
+}
+
+/**
+ * @brief Get a hash identifying the registration of an enumeration.
+ * @tparam E type of enumeration
+ * @return 64-bit FNV-1a hash of the type name and all strings, in order
+ *
+ * The fingerprint is stable across builds and processes as long as the
+ * ENUM_STRINGS invocation does not change, so it can be used to check
+ * that data written by one program is read with the same names.
+ */
+template <typename E>
+inline constexpr std::uint64_t fingerprint()
+{
+  auto const & strings = ::enum_strings::detail::get_strings<E>();
+  auto const & lengths = ::enum_strings::detail::get_lengths<E>();
+  std::uint64_t h = 14695981039346656037ull;
+  for (char const * p = ::enum_strings::type_name<E>(); *p != '\0'; ++p)
+  {
+    h = ::enum_strings::detail::fnv1a(h, *p);
+  }
+  for (std::size_t i = 0; i < ::enum_strings::num_values<E>(); ++i)
+  {
+    h = ::enum_strings::detail::fnv1a(h, '\0');
+    for (std::size_t j = 0; j < lengths[i]; ++j)
+    {
+      h = ::enum_strings::detail::fnv1a(h, strings[i][j]);
+    }
+  }
+  return h;
+}
+
+/**
+ * @brief Check whether a raw numerical code corresponds to an enum value associated with a string.
+ * @tparam E type of enumeration
+ * @param code the code to check
+ * @return @p true if @p code is in the range 0..num_values<E>()-1
+ *
+ * Negative codes of signed underlying types are always invalid.
+ */
+template <typename E>
+inline constexpr bool is_valid_code(std::underlying_type_t<E> const code)
+{
+  using unsigned_type = std::make_unsigned_t<std::underlying_type_t<E>>;
+  return static_cast<unsigned_type>(code) < ::enum_strings::num_values<E>();
+}
+
+/**
+ * @brief Non-owning reference to the name of an enum value.
+ */
+class name_view
+{
+public:
+
+  constexpr name_view() noexcept = default;
+
+  constexpr name_view(char const * const data, std::size_t const size) noexcept
+    : m_data(data),
+      m_size(size)
+  {}
+
+  constexpr char const * data() const noexcept { return m_data; }
+  constexpr std::size_t size() const noexcept { return m_size; }
+  constexpr bool empty() const noexcept { return m_size == 0; }
+  constexpr char const * begin() const noexcept { return m_data; }
+  constexpr char const * end() const noexcept { return m_data + m_size; }
+  constexpr char operator[](std::size_t const i) const noexcept { return m_data[i]; }
+
+  friend constexpr bool operator==(name_view const a, name_view const b) noexcept
+  {
+    if (a.m_size != b.m_size) return false;
+    for (std::size_t i = 0; i < a.m_size; ++i)
+    {
+      if (a.m_data[i] != b.m_data[i]) return false;
+    }
+    return true;
+  }
+
+  friend constexpr bool operator!=(name_view const a, name_view const b) noexcept
+  {
+    return !(a == b);
+  }
+
+private:
+
+  char const * m_data = "";
+  std::size_t m_size = 0;
+};
+
+/**
+ * @brief Convert enum to string without allocating or throwing.
+ * @tparam E type of enumeration
+ * @param e the enum value to convert
+ * @return a view of the corresponding string (null-terminated), or an empty view if @p e is out of range
+ */
+template <typename E>
+inline constexpr name_view to_string_view(E const e) noexcept
+{
+  auto const index = static_cast<std::underlying_type_t<E>>(e);
+  return ::enum_strings::is_valid_code<E>(index)
+         ? name_view(::enum_strings::detail::get_strings<E>()[index], ::enum_strings::detail::get_lengths<E>()[index])
+         : name_view();
+}
+
+/**
+ * @brief Get the length of the longest string registered for an enum type.
+ * @tparam E type of enumeration
+ * @return the number of characters in the longest string
+ */
+template <typename E>
+inline constexpr std::size_t max_name_length() noexcept
+{
+  std::size_t result = 0;
+  for (std::size_t i = 0; i < ::enum_strings::num_values<E>(); ++i)
+  {
+    result = ::enum_strings::detail::get_lengths<E>()[i] > result ? ::enum_strings::detail::get_lengths<E>()[i] : result;
+  }
+  return result;
+}
+
+/**
+ * @brief Get the length of the shortest string registered for an enum type.
+ * @tparam E type of enumeration
+ * @return the number of characters in the shortest string
+ */
+template <typename E>
+inline constexpr std::size_t min_name_length() noexcept
+{
+  std::size_t result = ::enum_strings::detail::get_lengths<E>()[0];
+  for (std::size_t i = 1; i < ::enum_strings::num_values<E>(); ++i)
+  {
+    result = ::enum_strings::detail::get_lengths<E>()[i] < result ? ::enum_strings::detail::get_lengths<E>()[i] : result;
+  }
+  return result;
+}
+
+/**
+ * @brief Null-terminated character array of a size known at compile time.
+ * @tparam N size including the terminating null character
+ */
+template <std::size_t N>
+struct char_array
+{
+  char data[N];
+
+  constexpr char const * c_str() const noexcept { return data; }
+  constexpr std::size_t size() const noexcept { return N - 1; }
+  constexpr name_view view() const noexcept { return { data, N - 1 }; }
+};
+
+namespace detail
+{
+
+/// Length of all names of @p E joined with a separator of @p M - 1 characters, counted up to @p max
+template <typename E, std::size_t M>
+inline constexpr std::size_t joined_length(std::size_t const max = static_cast<std::size_t>(-1))
+{
+  std::size_t result = 0;
+  for (std::size_t i = 0; i < ::enum_strings::num_values<E>() && result < max; ++i)
+  {
+    result += ::enum_strings::detail::get_lengths<E>()[i] + (i > 0 ? M - 1 : 0);
+  }
+  return result < max ? result : max;
+}
+
+/// Join names into an array of @p L characters, cutting the result if it is longer
+template <typename E, std::size_t L, std::size_t M>
+inline constexpr char_array<L + 1> join_names(char const (&separator)[M])
+{
+  char_array<L + 1> result{};
+  std::size_t pos = 0;
+  for (std::size_t i = 0; i < ::enum_strings::num_values<E>() && pos < L; ++i)
+  {
+    for (std::size_t j = 0; i > 0 && j < M - 1 && pos < L; ++j)
+    {
+      result.data[pos++] = separator[j];
+    }
+    for (std::size_t j = 0; j < ::enum_strings::detail::get_lengths<E>()[i] && pos < L; ++j)
+    {
+      result.data[pos++] = ::enum_strings::detail::get_strings<E>()[i][j];
+    }
+  }
+  result.data[pos] = '\0';
+  return result;
+}
+
+} // namespace detail
+
+/**
+ * @brief Join all names of an enumeration at compile time (e.g. for help text).
+ * @tparam E type of enumeration
+ * @param separator string literal to put between names
+ * @return a char_array holding the names in order, separated by @p separator
+ */
+template <typename E, std::size_t M>
+inline constexpr auto joined_names(char const (&separator)[M])
+{
+  return ::enum_strings::detail::join_names<E, ::enum_strings::detail::joined_length<E, M>()>(separator);
+}
+
+namespace detail
+{
+
+/// Linear search of the string table
+template <typename E>
+inline bool find_string(char const * const s, std::size_t const length, E & e, long) noexcept
+{
+  auto const & strings = ::enum_strings::detail::get_strings<E>();
+  auto const & lengths = ::enum_strings::detail::get_lengths<E>();
+  for (std::size_t n = 0; n < ::enum_strings::num_values<E>(); ++n)
+  {
+    if (lengths[n] == length && std::memcmp(strings[n], s, length) == 0)
+    {
+      e = static_cast<E>(n);
+      return true;
+    }
+  }
+  return false;
+}
+
+/// Custom lookup (e.g. a generated perfect hash) provided next to the enumeration, found by ADL
+template <typename E>
+inline auto find_string(char const * const s, std::size_t const length, E & e, int) noexcept
+  -> decltype(_find_enum_string(s, length, e))
+{
+  return _find_enum_string(s, length, e);
+}
+
+} // namespace detail
+
+/**
+ * @brief Convert string to enum without throwing or allocating.
+ * @tparam E type of enumeration
+ * @param s pointer to the characters of the string (need not be null-terminated)
+ * @param length number of characters
+ * @param e the value to assign if the string is found
+ * @return @p true if @p s is a string associated with given enum type, in which case @p e is assigned
+ */
+template <typename E>
+inline bool try_from_string(char const * const s, std::size_t const length, E & e) noexcept
+{
+  return ::enum_strings::detail::find_string(s, length, e, 0);
+}
+
+/**
+ * @brief Trivially copyable string with inline storage for exactly the longest name of an enum type.
+ * @tparam E type of enumeration
+ *
+ * Meant for records that cannot hold a std::string, such as fixed-layout messages or
+ * shared memory: the name is stored without a terminating null character, followed by
+ * a single length byte.
+ */
+template <typename E>
+class enum_name_buffer
+{
+public:
+
+  static_assert(!::enum_strings::detail::is_extern<E>::value,
+                "enum_name_buffer needs the names at compile time, register the enum with ENUM_STRINGS");
+
+  /// Number of characters the buffer can hold
+  static constexpr std::size_t capacity = ::enum_strings::max_name_length<E>();
+
+  static_assert(capacity <= 255, "Names longer than 255 characters do not fit in enum_name_buffer");
+
+  /// Construct an empty buffer
+  constexpr enum_name_buffer() noexcept = default;
+
+  /**
+   * @brief Construct a buffer holding the name of an enum value.
+   * @param e the enum value (the buffer is left empty if it is out of range)
+   */
+  constexpr explicit enum_name_buffer(E const e) noexcept
+  {
+    assign(e);
+  }
+
+  /**
+   * @brief Replace the contents with the name of an enum value.
+   * @param e the enum value (the buffer is left empty if it is out of range)
+   */
+  constexpr void assign(E const e) noexcept
+  {
+    name_view const name = ::enum_strings::to_string_view(e);
+    for (std::size_t i = 0; i < name.size(); ++i)
+    {
+      m_data[i] = name[i];
+    }
+    m_size = static_cast<unsigned char>(name.size());
+  }
+
+  /**
+   * @brief Convert the stored name back to enum.
+   * @param e the value to assign if the buffer holds a valid name
+   * @return @p true if the buffer holds a valid name, in which case @p e is assigned
+   */
+  bool to_enum(E & e) const noexcept
+  {
+    return ::enum_strings::try_from_string(m_data, m_size, e);
+  }
+
+  constexpr char const * data() const noexcept { return m_data; }
+  constexpr std::size_t size() const noexcept { return m_size; }
+  constexpr bool empty() const noexcept { return m_size == 0; }
+  constexpr name_view view() const noexcept { return { m_data, m_size }; }
+
+  friend constexpr bool operator==(enum_name_buffer const & a, enum_name_buffer const & b) noexcept
+  {
+    return a.view() == b.view();
+  }
+
+  friend constexpr bool operator!=(enum_name_buffer const & a, enum_name_buffer const & b) noexcept
+  {
+    return !(a == b);
+  }
+
+private:
+
+  char m_data[capacity] = {};
+  unsigned char m_size = 0;
+};
+
+#if __cplusplus < 201703L
+template <typename E>
+constexpr std::size_t enum_name_buffer<E>::capacity;
+#endif
+
+/**
+ * @brief Check a buffer of raw numerical codes (e.g. received from the wire) before converting them to enum.
+ * @tparam E type of enumeration
+ * @param codes the codes to check
+ * @param n number of codes
+ * @return the position of the first invalid code, or @p n if all codes are valid
+ *
+ * Uses the same rule as is_valid_code(). Codes are checked in branch-free
+ * blocks so that the loop can be vectorized by the compiler.
+ */
+template <typename E>
+inline std::size_t validate_codes(std::underlying_type_t<E> const * const codes, std::size_t const n)
+{
+  constexpr std::size_t block = 64;
+  for (std::size_t i = 0; i < n; i += block)
+  {
+    std::size_t const len = n - i < block ? n - i : block;
+    unsigned invalid = 0;
+    for (std::size_t j = 0; j < len; ++j)
+    {
+      invalid |= !::enum_strings::is_valid_code<E>(codes[i + j]);
+    }
+    if (invalid != 0)
+    {
+      std::size_t j = 0;
+      for (; ::enum_strings::is_valid_code<E>(codes[i + j]); ++j);
+      return i + j;
+    }
+  }
+  return n;
+}
+
+/**
+ * @brief Check a buffer of raw numerical codes and mark the invalid ones.
+ * @tparam E type of enumeration
+ * @param codes the codes to check
+ * @param n number of codes
+ * @param invalid output array of <tt>(n + 63) / 64</tt> words, bit <tt>i % 64</tt> of word <tt>i / 64</tt>
+ *        is set if <tt>codes[i]</tt> is invalid
+ * @return the number of invalid codes
+ */
+template <typename E>
+inline std::size_t validate_codes(std::underlying_type_t<E> const * const codes, std::size_t const n, std::uint64_t * const invalid)
+{
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; i += 64)
+  {
+    std::size_t const len = n - i < 64 ? n - i : 64;
+    std::uint64_t bits = 0;
+    for (std::size_t j = 0; j < len; ++j)
+    {
+      bits |= std::uint64_t{ !::enum_strings::is_valid_code<E>(codes[i + j]) } << j;
+    }
+    invalid[i / 64] = bits;
+    for (; bits != 0; bits &= bits - 1, ++count);
+  }
+  return count;
+}
+
+/**
+ * @brief Validate a buffer of raw numerical codes and convert it to enum values.
+ * @tparam E type of enumeration
+ * @param codes the codes to convert
+ * @param n number of codes
+ * @param out output array of @p n values, must not overlap @p codes
+ * @return the position of the first invalid code, or @p n if all codes are valid;
+ *         @p out is only written if all codes are valid
+ */
+template <typename E>
+inline std::size_t convert_codes(std::underlying_type_t<E> const * const codes, std::size_t const n, E * const out)
+{
+  std::size_t const pos = ::enum_strings::validate_codes<E>(codes, n);
+  if (pos == n)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      out[i] = static_cast<E>(codes[i]);
+    }
+  }
+  return pos;
+}
+
+/**
+ * @brief Description of a registered enumeration, as listed by registered_enums() (enum_strings_registry.h).
+ *
+ * Byte counts are those of the data as laid out by the registration, before any merging
+ * of identical string literals by the linker.
+ */
+struct registered_enum
+{
+  char const * type_name;    ///< type name as spelled in the registration
+  std::size_t count;         ///< number of values
+  std::uint64_t fingerprint; ///< see fingerprint()
+  std::size_t table_bytes;   ///< pointers to and lengths of the names
+  std::size_t name_bytes;    ///< characters of the type name and all names, with their terminating nulls
+  std::size_t index_bytes;   ///< lookup structures of from_string, e.g. a generated perfect hash
+
+  /// Total number of bytes used by the enumeration
+  constexpr std::size_t total_bytes() const noexcept
+  {
+    return table_bytes + name_bytes + index_bytes;
+  }
+};
+
+namespace detail
+{
+
+/// The linear search of the table uses no index
+template <typename E>
+inline constexpr std::size_t index_bytes(long) noexcept
+{
+  return 0;
+}
+
+/// Size of a custom lookup, reported by a hook found by ADL next to its @p _find_enum_string
+template <typename E>
+inline constexpr auto index_bytes(int) noexcept
+  -> decltype(_enum_strings_index_bytes(E{}))
+{
+  return _enum_strings_index_bytes(E{});
+}
+
+/// Describe a registered enumeration; the address of each instantiation is its registry entry
+template <typename E>
+inline ::enum_strings::registered_enum describe() noexcept
+{
+  std::size_t const count = ::enum_strings::num_values<E>();
+  auto const & lengths = ::enum_strings::detail::get_lengths<E>();
+  std::size_t name_bytes = ::enum_strings::detail::length(::enum_strings::type_name<E>()) + 1;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    name_bytes += lengths[i] + 1;
+  }
+  std::size_t const table_bytes = sizeof(char const *) + count * (sizeof(char const *) + sizeof(std::size_t))
+                                + (::enum_strings::detail::is_extern<E>::value ? sizeof(::enum_strings::detail::extern_table) : 0);
+  return { ::enum_strings::type_name<E>(), count, ::enum_strings::fingerprint<E>(),
+           table_bytes, name_bytes, ::enum_strings::detail::index_bytes<E>(0) };
+}
+
+/// Entry placed in the registry section by each registration
+using registry_entry = ::enum_strings::registered_enum (*)();
+
+} // namespace detail
+
+namespace detail
+{
+
+template< typename E, E = E::END >
+inline constexpr bool check_num_values(std::size_t const n, int)
+{
+  return n == static_cast<std::size_t>(static_cast<std::underlying_type_t<E>>(E::END));
+}
+
+template< typename >
+inline constexpr bool check_num_values(std::size_t, ...)
+{
+  return true;
+}
+
+} // namespace detail
+
+namespace detail
+{
+
+/// Selects the stream operators of enum_strings_iostream.h, found by ADL
+struct stream_tag {};
+
+template <typename S>
+struct missing_stream_support : std::false_type {};
+
+template <typename S, typename E>
+S & _write_enum_string(S & os, E, stream_tag)
+{
+  static_assert(missing_stream_support<S>::value, "Include enum_strings_iostream.h (or enum_strings.h) to stream enums");
+  return os;
+}
+
+template <typename S, typename E>
+S & _read_enum_string(S & is, E &, stream_tag)
+{
+  static_assert(missing_stream_support<S>::value, "Include enum_strings_iostream.h (or enum_strings.h) to stream enums");
+  return is;
+}
+
+} // namespace detail
+
+} //namespace enum_strings
+
+#endif //ENUM_STRINGS_CORE_H
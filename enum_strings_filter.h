@@ -0,0 +1,381 @@
+#ifndef ENUM_STRINGS_FILTER_H
+#define ENUM_STRINGS_FILTER_H
+
+/**
+ * @file enum_strings_filter.h
+ * @author Sergey Klevtsov
+ */
+
+#include "enum_strings.h"
+#include "enum_strings_set.h"
+
+#include <cstdint>
+#include <initializer_list>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace enum_strings
+{
+
+/**
+ * @brief Get the number of 64-bit words in a selection bitmap.
+ * @param n number of rows
+ * @return the number of words
+ */
+inline constexpr std::size_t bitmap_words(std::size_t const n)
+{
+  return (n + 63) / 64;
+}
+
+/**
+ * @brief Get the number of 64-bit words in a bit-packed code array.
+ * @param n number of codes
+ * @param bits number of bits per code
+ * @return the number of words
+ */
+inline constexpr std::size_t packed_words(std::size_t const n, unsigned const bits)
+{
+  return (n * bits + 63) / 64;
+}
+
+namespace detail
+{
+
+template <typename T, bool = std::is_enum<T>::value>
+struct code_traits
+{
+  using type = std::make_unsigned_t<T>;
+};
+
+template <typename T>
+struct code_traits<T, true>
+{
+  using type = std::make_unsigned_t<std::underlying_type_t<T>>;
+};
+
+/// Numeric code of an enum value or a raw integer, negative values wrap to large ones
+template <typename T>
+inline std::size_t code_index(T const v)
+{
+  return static_cast<std::size_t>(static_cast<typename code_traits<T>::type>(v));
+}
+
+inline unsigned ctz64(std::uint64_t const w)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<unsigned>(__builtin_ctzll(w));
+#else
+  unsigned n = 0;
+  for (; ((w >> n) & 1) == 0; ++n);
+  return n;
+#endif
+}
+
+template <typename U>
+inline void unpack_codes(std::uint64_t const * const packed,
+                         std::size_t const first,
+                         std::size_t const len,
+                         unsigned const bits,
+                         U * const out)
+{
+  std::uint64_t const mask = bits == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << bits) - 1;
+  std::size_t bit = first * bits;
+  for (std::size_t i = 0; i < len; ++i, bit += bits)
+  {
+    std::size_t const w = bit / 64;
+    unsigned const s = bit % 64;
+    std::uint64_t v = packed[w] >> s;
+    if (s + bits > 64)
+    {
+      v |= packed[w + 1] << (64 - s);
+    }
+    out[i] = static_cast<U>(v & mask);
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Pack integer or enum codes into a dense bit stream.
+ * @param codes the codes to pack
+ * @param n number of codes
+ * @param bits number of bits per code (1..32), codes must fit
+ * @param packed output array of packed_words(n, bits) words
+ *
+ * Code @p i occupies stream bits <tt>[i * bits, (i + 1) * bits)</tt>,
+ * stream bit @p j being bit <tt>j % 64</tt> of word <tt>j / 64</tt>.
+ */
+template <typename T>
+inline void pack_codes(T const * const codes,
+                       std::size_t const n,
+                       unsigned const bits,
+                       std::uint64_t * const packed)
+{
+  for (std::size_t w = 0; w < ::enum_strings::packed_words(n, bits); ++w)
+  {
+    packed[w] = 0;
+  }
+  std::size_t bit = 0;
+  for (std::size_t i = 0; i < n; ++i, bit += bits)
+  {
+    std::uint64_t const v = ::enum_strings::detail::code_index(codes[i]);
+    std::size_t const w = bit / 64;
+    unsigned const s = bit % 64;
+    packed[w] |= v << s;
+    if (s + bits > 64)
+    {
+      packed[w + 1] |= v >> (64 - s);
+    }
+  }
+}
+
+/**
+ * @brief A predicate "value is one of the given names" evaluated over columns of codes.
+ * @tparam E type of enumeration
+ *
+ * Names are resolved once on construction; evaluation never touches strings.
+ * Codes may be given as arrays of @p E, arrays of raw integers, or bit-packed
+ * (see pack_codes()). Codes outside of the registered range never match.
+ * When compiled with AVX2 enabled, one-byte codes (including packed codes of
+ * up to 8 bits) are matched 32 at a time using byte shuffles or compares.
+ */
+template <typename E>
+class enum_filter
+{
+public:
+
+  /**
+   * @brief Construct a filter from a set of values.
+   * @param set values to select
+   */
+  explicit enum_filter(::enum_strings::enum_set<E> const & set)
+    : m_set(set)
+  {
+    init();
+  }
+
+  /**
+   * @brief Construct a filter from a list of names.
+   * @param names names to select
+   * @exception std::invalid_argument if any of @p names is not a string associated with @p E
+   */
+  enum_filter(std::initializer_list<std::string> names)
+    : enum_filter(names.begin(), names.end())
+  {}
+
+  /**
+   * @brief Construct a filter from a range of names.
+   * @param first beginning of range of names
+   * @param last end of range of names
+   * @exception std::invalid_argument if any of the names is not a string associated with @p E
+   */
+  template <typename It>
+  enum_filter(It first, It const last)
+  {
+    for (; first != last; ++first)
+    {
+      m_set.insert(::enum_strings::from_string<E>(*first));
+    }
+    init();
+  }
+
+  /**
+   * @return the set of selected values
+   */
+  ::enum_strings::enum_set<E> const & values() const noexcept
+  {
+    return m_set;
+  }
+
+  /**
+   * @brief Compute a selection bitmap over an array of codes.
+   * @param codes input codes (enum values or raw integers)
+   * @param n number of codes
+   * @param bitmap output array of bitmap_words(n) words, bit @p i is set if row @p i is selected
+   */
+  template <typename T>
+  void select(T const * const codes, std::size_t const n, std::uint64_t * const bitmap) const noexcept
+  {
+    for (std::size_t i = 0; i < n; i += 64)
+    {
+      bitmap[i / 64] = match(codes + i, n - i < 64 ? n - i : 64);
+    }
+  }
+
+  /**
+   * @brief Compute a list of selected row indices over an array of codes.
+   * @param codes input codes (enum values or raw integers)
+   * @param n number of codes
+   * @param indices output array with space for up to @p n indices
+   * @return the number of selected rows written to @p indices
+   */
+  template <typename T, typename I>
+  std::size_t select_indices(T const * const codes, std::size_t const n, I * const indices) const noexcept
+  {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; i += 64)
+    {
+      count += emit(match(codes + i, n - i < 64 ? n - i : 64), i, indices + count);
+    }
+    return count;
+  }
+
+  /**
+   * @brief Compute a selection bitmap over a bit-packed array of codes.
+   * @param packed input codes packed with pack_codes()
+   * @param n number of codes
+   * @param bits number of bits per code (1..32)
+   * @param bitmap output array of bitmap_words(n) words
+   */
+  void select_packed(std::uint64_t const * const packed,
+                     std::size_t const n,
+                     unsigned const bits,
+                     std::uint64_t * const bitmap) const noexcept
+  {
+    for (std::size_t i = 0; i < n; i += 64)
+    {
+      bitmap[i / 64] = match_packed(packed, i, n - i < 64 ? n - i : 64, bits);
+    }
+  }
+
+  /**
+   * @brief Compute a list of selected row indices over a bit-packed array of codes.
+   * @param packed input codes packed with pack_codes()
+   * @param n number of codes
+   * @param bits number of bits per code (1..32)
+   * @param indices output array with space for up to @p n indices
+   * @return the number of selected rows written to @p indices
+   */
+  template <typename I>
+  std::size_t select_packed_indices(std::uint64_t const * const packed,
+                                    std::size_t const n,
+                                    unsigned const bits,
+                                    I * const indices) const noexcept
+  {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; i += 64)
+    {
+      count += emit(match_packed(packed, i, n - i < 64 ? n - i : 64, bits), i, indices + count);
+    }
+    return count;
+  }
+
+private:
+
+  static constexpr std::size_t N = ::enum_strings::num_values<E>();
+  static constexpr unsigned max_compares = 8;
+
+  enum class mode { scalar, shuffle, compare };
+
+  void init() noexcept
+  {
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      m_lut[i] = m_set.contains(static_cast<E>(i)) ? 0xFF : 0;
+    }
+    m_lut[N] = 0;
+
+    m_mode = mode::scalar;
+    if (N <= 16)
+    {
+      m_mode = mode::shuffle;
+    }
+    else if (m_set.size() <= max_compares)
+    {
+      // members >= 128 could compare equal to negative one-byte codes
+      bool fits = true;
+      m_set.for_each([this, &fits](E const e)
+      {
+        auto const i = ::enum_strings::detail::code_index(e);
+        fits = fits && i < 128;
+        m_members[m_num_members++] = static_cast<std::uint8_t>(i);
+      });
+      m_mode = fits ? mode::compare : mode::scalar;
+    }
+  }
+
+  template <typename I>
+  static std::size_t emit(std::uint64_t bits, std::size_t const base, I * const indices) noexcept
+  {
+    std::size_t count = 0;
+    for (; bits != 0; bits &= bits - 1)
+    {
+      indices[count++] = static_cast<I>(base + ::enum_strings::detail::ctz64(bits));
+    }
+    return count;
+  }
+
+  std::uint64_t match_packed(std::uint64_t const * const packed,
+                             std::size_t const first,
+                             std::size_t const len,
+                             unsigned const bits) const noexcept
+  {
+    if (bits <= 8)
+    {
+      std::uint8_t codes[64];
+      ::enum_strings::detail::unpack_codes(packed, first, len, bits, codes);
+      return match(codes, len);
+    }
+    std::uint32_t codes[64];
+    ::enum_strings::detail::unpack_codes(packed, first, len, bits, codes);
+    return match(codes, len);
+  }
+
+  template <typename T>
+  std::uint64_t match(T const * const codes, std::size_t const len) const noexcept
+  {
+#if defined(__AVX2__)
+    if (sizeof(T) == 1 && len == 64 && m_mode != mode::scalar)
+    {
+      return match_avx2(reinterpret_cast<char const *>(codes));
+    }
+#endif
+    std::uint64_t bits = 0;
+    for (std::size_t i = 0; i < len; ++i)
+    {
+      std::size_t const c = ::enum_strings::detail::code_index(codes[i]);
+      bits |= std::uint64_t{ m_lut[c < N ? c : N] & 1u } << i;
+    }
+    return bits;
+  }
+
+#if defined(__AVX2__)
+  std::uint64_t match_avx2(char const * const codes) const noexcept
+  {
+    std::uint32_t const lo = static_cast<std::uint32_t>(_mm256_movemask_epi8(match_avx2(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(codes)))));
+    std::uint32_t const hi = static_cast<std::uint32_t>(_mm256_movemask_epi8(match_avx2(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(codes + 32)))));
+    return std::uint64_t{lo} | (std::uint64_t{hi} << 32);
+  }
+
+  __m256i match_avx2(__m256i const v) const noexcept
+  {
+    if (m_mode == mode::shuffle)
+    {
+      // pshufb only looks at the low 4 bits, so mask out codes >= N separately
+      __m256i const table = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(m_lut)));
+      __m256i const top = _mm256_set1_epi8(static_cast<char>(N - 1));
+      __m256i const in_range = _mm256_cmpeq_epi8(_mm256_max_epu8(v, top), top);
+      return _mm256_and_si256(_mm256_shuffle_epi8(table, v), in_range);
+    }
+    __m256i acc = _mm256_setzero_si256();
+    for (unsigned k = 0; k < m_num_members; ++k)
+    {
+      acc = _mm256_or_si256(acc, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(static_cast<char>(m_members[k]))));
+    }
+    return acc;
+  }
+#endif
+
+  ::enum_strings::enum_set<E> m_set;
+  mode m_mode = mode::scalar;
+  unsigned m_num_members = 0;
+  std::uint8_t m_members[max_compares] {};
+  // one entry per value plus a trailing zero for out-of-range codes; at least 16 for the shuffle table
+  std::uint8_t m_lut[N + 1 < 16 ? 16 : N + 1] {};
+};
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_FILTER_H
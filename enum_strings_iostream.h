@@ -0,0 +1,126 @@
+#ifndef ENUM_STRINGS_IOSTREAM_H
+#define ENUM_STRINGS_IOSTREAM_H
+
+/**
+ * @file enum_strings_iostream.h
+ * @author Sergey Klevtsov
+ */
+
+#include "enum_strings_string.h"
+
+#include <istream>
+#include <ostream>
+
+#if defined(__GNUC__)
+#define ENUM_STRINGS_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define ENUM_STRINGS_NOINLINE __declspec(noinline)
+#else
+#define ENUM_STRINGS_NOINLINE
+#endif
+
+namespace enum_strings
+{
+
+namespace detail
+{
+
+/// Index of the stream word holding the enum format, nonzero for numeric codes
+inline int stream_format_index()
+{
+  static int const index = std::ios_base::xalloc();
+  return index;
+}
+
+/**
+ * @brief Write an enum value as its code @p index or as its @p name, according to the stream format.
+ *
+ * Shared by all enums and kept out of line, so that operator<< call sites only pay for a call.
+ */
+template <typename T>
+ENUM_STRINGS_NOINLINE std::basic_ostream<char, T> & write_enum(std::basic_ostream<char, T> & os, std::size_t const index,
+                                                             char const * const name)
+{
+  if (os.iword(::enum_strings::detail::stream_format_index()) != 0)
+  {
+    return os << index;
+  }
+  // Registered names are null-terminated and contain no null characters, so no temporary string is needed
+  return os << name;
+}
+
+/**
+ * @brief Read a numerical code if the stream is set to numeric(), shared by all enums.
+ * @param code set to the code read, or to -1 if reading failed
+ * @return @p true if the stream is set to numeric(), @p false if set to names()
+ */
+template <typename T>
+ENUM_STRINGS_NOINLINE bool read_numeric(std::basic_istream<char, T> & is, long long & code)
+{
+  if (is.iword(::enum_strings::detail::stream_format_index()) == 0)
+  {
+    return false;
+  }
+  if (!(is >> code))
+  {
+    code = -1;
+  }
+  return true;
+}
+
+/// Implementation of operator<< injected by ENUM_STRINGS
+template <typename T, typename E>
+inline std::basic_ostream<char, T> & _write_enum_string(std::basic_ostream<char, T> & os, E const e, stream_tag)
+{
+  std::size_t const index = ::enum_strings::detail::checked_index(e);
+  return ::enum_strings::detail::write_enum(os, index, ::enum_strings::detail::get_strings<E>()[index]);
+}
+
+/// Implementation of operator>> injected by ENUM_STRINGS
+template <typename T, typename E>
+inline std::basic_istream<char, T> & _read_enum_string(std::basic_istream<char, T> & is, E & e, stream_tag)
+{
+  long long code;
+  if (::enum_strings::detail::read_numeric(is, code))
+  {
+    if (is)
+    {
+      if (code < 0 || static_cast<unsigned long long>(code) >= ::enum_strings::num_values<E>())
+      {
+        ::enum_strings::detail::throw_invalid_value<E>(code);
+      }
+      e = static_cast<E>(code);
+    }
+    return is;
+  }
+  std::string s; is >> s;
+  e = ::enum_strings::from_string<E>(s);
+  return is;
+}
+
+} // namespace detail
+
+/**
+ * @brief Stream manipulator making the stream operators of registered enums write and read numerical codes.
+ *
+ * The setting is stored in the stream (in @p std::ios_base::iword) and stays until changed by names().
+ * Codes are validated the same way as names: out-of-range values throw std::invalid_argument.
+ */
+inline std::ios_base & numeric(std::ios_base & s)
+{
+  s.iword(::enum_strings::detail::stream_format_index()) = 1;
+  return s;
+}
+
+/**
+ * @brief Stream manipulator restoring the default: registered enums are written and read by name.
+ */
+inline std::ios_base & names(std::ios_base & s)
+{
+  s.iword(::enum_strings::detail::stream_format_index()) = 0;
+  return s;
+}
+
+} //namespace enum_strings
+
+#endif //ENUM_STRINGS_IOSTREAM_H
@@ -0,0 +1,275 @@
+#ifndef ENUM_STRINGS_JSON_H
+#define ENUM_STRINGS_JSON_H
+
+/**
+ * @file enum_strings_json.h
+ * @author Sergey Klevtsov
+ */
+
+#include "enum_strings.h"
+
+#include <cstring>
+
+namespace enum_strings
+{
+
+namespace detail
+{
+
+/// Length of a character escaped in a JSON string
+inline constexpr std::size_t json_escaped_length(char const c)
+{
+  return (c == '"' || c == '\\' || c == '\b' || c == '\f' || c == '\n' || c == '\r' || c == '\t') ? 2
+       : (static_cast<unsigned char>(c) < 0x20) ? 6
+       : 1;
+}
+
+template <typename E>
+inline constexpr std::size_t json_pool_size()
+{
+  auto const & table = ::enum_strings::detail::storage<E>::value;
+  std::size_t size = 0;
+  for (std::size_t i = 0; i < ::enum_strings::num_values<E>(); ++i)
+  {
+    size += 2;
+    for (std::size_t j = 0; j < table.lengths[i]; ++j)
+    {
+      size += ::enum_strings::detail::json_escaped_length(table.strings[i][j]);
+    }
+  }
+  return size;
+}
+
+/// Quoted and escaped names stored back to back, name @p i at <tt>[offsets[i], offsets[i + 1])</tt>
+template <std::size_t N, std::size_t S>
+struct json_table
+{
+  char pool[S];
+  std::size_t offsets[N + 1];
+};
+
+template <typename E>
+inline constexpr auto make_json_table()
+{
+  constexpr std::size_t N = ::enum_strings::num_values<E>();
+  auto const & table = ::enum_strings::detail::storage<E>::value;
+  json_table<N, ::enum_strings::detail::json_pool_size<E>()> result{};
+  std::size_t pos = 0;
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    result.offsets[i] = pos;
+    result.pool[pos++] = '"';
+    for (std::size_t j = 0; j < table.lengths[i]; ++j)
+    {
+      char const c = table.strings[i][j];
+      switch (::enum_strings::detail::json_escaped_length(c))
+      {
+        case 1:
+          result.pool[pos++] = c;
+          break;
+        case 2:
+          result.pool[pos++] = '\\';
+          result.pool[pos++] = c == '\b' ? 'b' : c == '\f' ? 'f' : c == '\n' ? 'n' : c == '\r' ? 'r' : c == '\t' ? 't' : c;
+          break;
+        default:
+          result.pool[pos++] = '\\';
+          result.pool[pos++] = 'u';
+          result.pool[pos++] = '0';
+          result.pool[pos++] = '0';
+          result.pool[pos++] = "0123456789abcdef"[static_cast<unsigned char>(c) >> 4];
+          result.pool[pos++] = "0123456789abcdef"[static_cast<unsigned char>(c) & 0xF];
+          break;
+      }
+    }
+    result.pool[pos++] = '"';
+  }
+  result.offsets[N] = pos;
+  return result;
+}
+
+template <typename E>
+struct json_storage
+{
+  using type = decltype(::enum_strings::detail::make_json_table<E>());
+  static constexpr type value = ::enum_strings::detail::make_json_table<E>();
+};
+
+#if __cplusplus < 201703L
+template <typename E>
+constexpr typename json_storage<E>::type json_storage<E>::value;
+#endif
+
+inline int hex_digit(char const c) noexcept
+{
+  return (c >= '0' && c <= '9') ? c - '0'
+       : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+       : (c >= 'A' && c <= 'F') ? c - 'A' + 10
+       : -1;
+}
+
+inline bool read_hex4(char const * const s, unsigned & cp) noexcept
+{
+  cp = 0;
+  for (int i = 0; i < 4; ++i)
+  {
+    int const d = ::enum_strings::detail::hex_digit(s[i]);
+    if (d < 0) return false;
+    cp = (cp << 4) | static_cast<unsigned>(d);
+  }
+  return true;
+}
+
+/**
+ * @brief Unescape JSON string contents into a fixed-size buffer.
+ * @return the unescaped length, or @p capacity + 1 if it does not fit or the input is malformed
+ */
+inline std::size_t json_unescape(char const * const s, std::size_t const n, char * const out, std::size_t const capacity) noexcept
+{
+  std::size_t const fail = capacity + 1;
+  std::size_t len = 0;
+  auto const put = [&](unsigned const c) { if (len < capacity) out[len] = static_cast<char>(c); ++len; };
+  for (std::size_t i = 0; i < n && len <= capacity; ++i)
+  {
+    if (s[i] != '\\')
+    {
+      put(static_cast<unsigned char>(s[i]));
+      continue;
+    }
+    if (++i == n) return fail;
+    switch (s[i])
+    {
+      case '"': case '\\': case '/': put(static_cast<unsigned char>(s[i])); break;
+      case 'b': put('\b'); break;
+      case 'f': put('\f'); break;
+      case 'n': put('\n'); break;
+      case 'r': put('\r'); break;
+      case 't': put('\t'); break;
+      case 'u':
+      {
+        unsigned cp;
+        if (i + 4 >= n || !::enum_strings::detail::read_hex4(s + i + 1, cp)) return fail;
+        i += 4;
+        if (cp >= 0xD800 && cp < 0xDC00)
+        {
+          unsigned lo;
+          if (i + 6 >= n || s[i + 1] != '\\' || s[i + 2] != 'u' || !::enum_strings::detail::read_hex4(s + i + 3, lo) || lo < 0xDC00 || lo >= 0xE000) return fail;
+          i += 6;
+          cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+        }
+        else if (cp >= 0xDC00 && cp < 0xE000)
+        {
+          return fail;
+        }
+        // encode as UTF-8
+        if (cp < 0x80) { put(cp); }
+        else if (cp < 0x800) { put(0xC0 | (cp >> 6)); put(0x80 | (cp & 0x3F)); }
+        else if (cp < 0x10000) { put(0xE0 | (cp >> 12)); put(0x80 | ((cp >> 6) & 0x3F)); put(0x80 | (cp & 0x3F)); }
+        else { put(0xF0 | (cp >> 18)); put(0x80 | ((cp >> 12) & 0x3F)); put(0x80 | ((cp >> 6) & 0x3F)); put(0x80 | (cp & 0x3F)); }
+        break;
+      }
+      default:
+        return fail;
+    }
+  }
+  return len <= capacity ? len : fail;
+}
+
+} // namespace detail
+
+/**
+ * @brief Get the length of the JSON representation of an enum value.
+ * @param e the enum value
+ * @return length of the quoted and escaped name
+ * @exception std::invalid_argument if @p e is out of range
+ */
+template <typename E>
+inline std::size_t json_length(E const e)
+{
+  auto const & table = ::enum_strings::detail::json_storage<E>::value;
+  std::size_t const index = ::enum_strings::detail::checked_index(e);
+  return table.offsets[index + 1] - table.offsets[index];
+}
+
+/**
+ * @brief Get the maximum length of the JSON representation of any value of an enumeration.
+ * @tparam E type of enumeration
+ */
+template <typename E>
+inline constexpr std::size_t max_json_length()
+{
+  auto const & table = ::enum_strings::detail::json_storage<E>::value;
+  std::size_t result = 0;
+  for (std::size_t i = 0; i < ::enum_strings::num_values<E>(); ++i)
+  {
+    std::size_t const len = table.offsets[i + 1] - table.offsets[i];
+    result = len > result ? len : result;
+  }
+  return result;
+}
+
+/**
+ * @brief Write an enum value as a JSON string (quoted and escaped name).
+ * @param e the enum value
+ * @param out output buffer with space for at least json_length(e) characters
+ * @return pointer past the last character written
+ * @exception std::invalid_argument if @p e is out of range
+ *
+ * The quoted names are built at compile time, so this is a single copy.
+ */
+template <typename E>
+inline char * to_json(E const e, char * const out)
+{
+  auto const & table = ::enum_strings::detail::json_storage<E>::value;
+  std::size_t const index = ::enum_strings::detail::checked_index(e);
+  std::size_t const len = table.offsets[index + 1] - table.offsets[index];
+  std::memcpy(out, table.pool + table.offsets[index], len);
+  return out + len;
+}
+
+/**
+ * @brief Convert the contents of a JSON string token to enum without allocating.
+ * @param s pointer to the raw characters between the quotes (still escaped)
+ * @param n number of characters
+ * @param e the value to assign if the string is found
+ * @return @p true if the unescaped string is associated with given enum type
+ *
+ * If there is no backslash in the token, the raw characters are matched directly;
+ * otherwise they are unescaped into a stack buffer sized for the longest name.
+ */
+template <typename E>
+inline bool try_from_json(char const * const s, std::size_t const n, E & e) noexcept
+{
+  if (std::memchr(s, '\\', n) == nullptr)
+  {
+    return ::enum_strings::try_from_string(s, n, e);
+  }
+  constexpr std::size_t capacity = ::enum_strings::max_name_length<E>();
+  char buf[capacity + 1];
+  std::size_t const len = ::enum_strings::detail::json_unescape(s, n, buf, capacity);
+  return len <= capacity && ::enum_strings::try_from_string(buf, len, e);
+}
+
+/**
+ * @brief Convert the contents of a JSON string token to enum.
+ * @param s pointer to the raw characters between the quotes (still escaped)
+ * @param n number of characters
+ * @return the corresponding enum value
+ * @exception std::invalid_argument if the string is not associated with given enum type
+ */
+template <typename E>
+inline E from_json(char const * const s, std::size_t const n)
+{
+  E e{};
+  if (!::enum_strings::try_from_json(s, n, e))
+  {
+    ::enum_strings::detail::message_buffer msg;
+    msg.append_quoted(s, n) << " is not a valid JSON representation of this type. Valid values are: ";
+    ::enum_strings::detail::append_names<E>(msg);
+    throw std::invalid_argument(msg.c_str());
+  }
+  return e;
+}
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_JSON_H
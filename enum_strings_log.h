@@ -0,0 +1,323 @@
+#ifndef ENUM_STRINGS_LOG_H
+#define ENUM_STRINGS_LOG_H
+
+/**
+ * @file enum_strings_log.h
+ * @author Sergey Klevtsov
+ */
+
+#include "enum_strings.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <utility>
+
+namespace enum_strings
+{
+
+/**
+ * @brief Support for binary loggers that format enum values later (in a background thread or offline).
+ *
+ * The critical path encodes a value as a small per-process type index and its
+ * numerical code (usually 2 bytes). The name tables of all types that were
+ * assigned an index are written once with write_schema(), into the log header
+ * or a sidecar file, and a schema read back from there turns codes into names.
+ */
+namespace log
+{
+
+/// Maximum number of bytes written by encode()
+constexpr std::size_t max_encoded_size = 15;
+
+namespace detail
+{
+
+inline char * write_varint(std::uint64_t v, char * out) noexcept
+{
+  for (; v >= 0x80; v >>= 7)
+  {
+    *out++ = static_cast<char>((v & 0x7F) | 0x80);
+  }
+  *out++ = static_cast<char>(v);
+  return out;
+}
+
+inline bool read_varint(char const * & p, char const * const end, std::uint64_t & v) noexcept
+{
+  v = 0;
+  for (unsigned shift = 0; p < end && shift < 64; shift += 7)
+  {
+    auto const byte = static_cast<unsigned char>(*p++);
+    v |= std::uint64_t{ byte & 0x7Fu } << shift;
+    if ((byte & 0x80) == 0) return true;
+  }
+  return false;
+}
+
+struct type_entry
+{
+  char const * type_name;
+  std::uint64_t fingerprint;
+  std::size_t count;
+  char const * const * strings;
+  std::size_t const * lengths;
+};
+
+inline std::mutex & registry_mutex()
+{
+  static std::mutex m;
+  return m;
+}
+
+inline std::vector<type_entry> & registry()
+{
+  static std::vector<type_entry> r;
+  return r;
+}
+
+template <typename E>
+inline std::uint32_t add_type()
+{
+  std::lock_guard<std::mutex> lock(registry_mutex());
+  registry().push_back({ ::enum_strings::type_name<E>(),
+                         ::enum_strings::fingerprint<E>(),
+                         ::enum_strings::num_values<E>(),
+                         ::enum_strings::detail::get_strings<E>(),
+                         ::enum_strings::detail::get_lengths<E>() });
+  return static_cast<std::uint32_t>(registry().size() - 1);
+}
+
+} // namespace detail
+
+/**
+ * @brief Get the index identifying an enumeration type in this process' log schema.
+ * @tparam E type of enumeration
+ * @return the index, assigned on first call
+ */
+template <typename E>
+inline std::uint32_t type_index()
+{
+  static std::uint32_t const index = ::enum_strings::log::detail::add_type<E>();
+  return index;
+}
+
+/**
+ * @brief Assign type indices up front, so that a schema written at the start of a log covers these types.
+ */
+template <typename ... Es>
+inline void register_types()
+{
+  (void) std::initializer_list<int>{ ((void) ::enum_strings::log::type_index<Es>(), 0) ... };
+}
+
+/**
+ * @brief Encode only the numerical code of a value, for when the type is known from the call site.
+ * @param e the value to encode
+ * @param out output buffer with space for at least 10 bytes
+ * @return pointer past the last byte written
+ * @exception std::invalid_argument if @p e is out of range
+ */
+template <typename E>
+inline char * encode_code(E const e, char * const out)
+{
+  return ::enum_strings::log::detail::write_varint(::enum_strings::detail::checked_index(e), out);
+}
+
+/**
+ * @brief Encode a value as its type index followed by its numerical code.
+ * @param e the value to encode
+ * @param out output buffer with space for at least max_encoded_size bytes
+ * @return pointer past the last byte written (2 bytes for up to 128 types of up to 128 values)
+ * @exception std::invalid_argument if @p e is out of range
+ */
+template <typename E>
+inline char * encode(E const e, char * const out)
+{
+  return ::enum_strings::log::encode_code(e, ::enum_strings::log::detail::write_varint(::enum_strings::log::type_index<E>(), out));
+}
+
+/**
+ * @brief Write the name tables of all types that were assigned an index so far.
+ * @param os the stream to write to
+ *
+ * The format is textual, with length-prefixed names:
+ * @code
+ * enum_strings schema 1
+ * type <index> <fingerprint in hex> <count> <length> <type name>
+ * <length> <name>
+ * ...
+ * @endcode
+ */
+inline void write_schema(std::ostream & os)
+{
+  std::vector<::enum_strings::log::detail::type_entry> entries;
+  {
+    std::lock_guard<std::mutex> lock(::enum_strings::log::detail::registry_mutex());
+    entries = ::enum_strings::log::detail::registry();
+  }
+  os << "enum_strings schema 1\n";
+  for (std::size_t t = 0; t < entries.size(); ++t)
+  {
+    auto const & entry = entries[t];
+    os << "type " << t << ' ' << std::hex << entry.fingerprint << std::dec << ' ' << entry.count << ' '
+       << std::char_traits<char>::length(entry.type_name) << ' ' << entry.type_name << '\n';
+    for (std::size_t i = 0; i < entry.count; ++i)
+    {
+      os << entry.lengths[i] << ' ';
+      os.write(entry.strings[i], static_cast<std::streamsize>(entry.lengths[i]));
+      os << '\n';
+    }
+  }
+}
+
+/**
+ * @brief Name tables read back from write_schema() output, used to decode logged values.
+ */
+class schema
+{
+public:
+
+  struct type
+  {
+    std::string type_name;
+    std::uint64_t fingerprint;
+    std::vector<std::string> names;
+  };
+
+  /**
+   * @brief Read a schema.
+   * @param is the stream to read from
+   * @exception std::runtime_error if the input is malformed
+   */
+  explicit schema(std::istream & is)
+  {
+    std::string line;
+    if (!std::getline(is, line) || line != "enum_strings schema 1")
+    {
+      throw std::runtime_error("Not an enum_strings schema");
+    }
+    std::string tag;
+    while (is >> tag)
+    {
+      std::size_t index, count;
+      type t;
+      if (tag != "type" || !(is >> index >> std::hex >> t.fingerprint >> std::dec >> count) || index != m_types.size())
+      {
+        throw std::runtime_error("Malformed enum_strings schema");
+      }
+      t.type_name = read_string(is);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        t.names.push_back(read_string(is));
+      }
+      m_types.push_back(std::move(t));
+    }
+  }
+
+  /**
+   * @return the number of types in the schema
+   */
+  std::size_t size() const noexcept
+  {
+    return m_types.size();
+  }
+
+  /**
+   * @brief Get a type by index.
+   * @exception std::out_of_range if there is no such type
+   */
+  type const & at(std::size_t const index) const
+  {
+    return m_types.at(index);
+  }
+
+  /**
+   * @brief Find a type by fingerprint.
+   * @return the type index, or size() if not found
+   */
+  std::size_t find(std::uint64_t const fingerprint) const noexcept
+  {
+    std::size_t i = 0;
+    for (; i < m_types.size() && m_types[i].fingerprint != fingerprint; ++i);
+    return i;
+  }
+
+  /**
+   * @brief Get the name of a value.
+   * @param index type index
+   * @param code numerical code
+   * @exception std::out_of_range if there is no such type or value
+   */
+  std::string const & name(std::size_t const index, std::uint64_t const code) const
+  {
+    auto const & names = at(index).names;
+    if (code >= names.size())
+    {
+      throw std::out_of_range("Invalid value " + std::to_string(code) + " of type " + at(index).type_name);
+    }
+    return names[code];
+  }
+
+  /**
+   * @brief Decode a value written by encode().
+   * @param p pointer to the encoded value, advanced past it
+   * @param end end of the input
+   * @return the name of the value
+   * @exception std::out_of_range if the input is truncated or does not match the schema
+   */
+  std::string const & decode(char const * & p, char const * const end) const
+  {
+    std::uint64_t index;
+    if (!::enum_strings::log::detail::read_varint(p, end, index))
+    {
+      throw std::out_of_range("Truncated enum type index");
+    }
+    return decode_code(static_cast<std::size_t>(index), p, end);
+  }
+
+  /**
+   * @brief Decode a value written by encode_code().
+   * @param index type index
+   * @param p pointer to the encoded value, advanced past it
+   * @param end end of the input
+   * @return the name of the value
+   * @exception std::out_of_range if the input is truncated or does not match the schema
+   */
+  std::string const & decode_code(std::size_t const index, char const * & p, char const * const end) const
+  {
+    std::uint64_t code;
+    if (!::enum_strings::log::detail::read_varint(p, end, code))
+    {
+      throw std::out_of_range("Truncated enum value");
+    }
+    return name(index, code);
+  }
+
+private:
+
+  static std::string read_string(std::istream & is)
+  {
+    std::size_t length;
+    if (!(is >> length) || is.get() != ' ')
+    {
+      throw std::runtime_error("Malformed enum_strings schema");
+    }
+    std::string s(length, '\0');
+    if (!is.read(&s[0], static_cast<std::streamsize>(length)) || is.get() == std::char_traits<char>::eof())
+    {
+      throw std::runtime_error("Malformed enum_strings schema");
+    }
+    return s;
+  }
+
+  std::vector<type> m_types;
+};
+
+} // namespace log
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_LOG_H
@@ -0,0 +1,169 @@
+#ifndef ENUM_STRINGS_MACROS_H
+#define ENUM_STRINGS_MACROS_H
+
+/**
+ * @file enum_strings_macros.h
+ * @author Sergey Klevtsov
+ *
+ * Registration macros only. Included by enum_strings_core.h; include it directly
+ * together with <tt>import enum_strings;</tt> when using the C++20 module.
+ */
+
+#include <cstddef>
+#include <iosfwd>
+#include <type_traits>
+
+#define ENUM_STRINGS_DETAIL_CAT_(A, B) A##B
+#define ENUM_STRINGS_DETAIL_CAT(A, B) ENUM_STRINGS_DETAIL_CAT_(A, B)
+
+/*
+ * Every registration places a pointer to its enum_strings::detail::describe<E> in the
+ * enum_strings_registry section, which the linker gathers between __start_ and __stop_
+ * symbols: the registry is built without any code running at startup. Every translation
+ * unit expanding a registration contributes its own entry (one pointer) and instantiates
+ * describe<E>, whose copies the linker merges; entries are deduplicated when read. The
+ * section is per module: each executable and shared library has its own registry.
+ */
+#if defined(__GNUC__) && defined(__ELF__)
+#define ENUM_STRINGS_HAVE_REGISTRY 1
+#define ENUM_STRINGS_DETAIL_REGISTER(E)                         \
+  namespace                                                     \
+  {                                                             \
+    __attribute__((section("enum_strings_registry"), used))     \
+    ::enum_strings::detail::registry_entry const                \
+    ENUM_STRINGS_DETAIL_CAT(_enum_strings_registry_entry_,      \
+                            __COUNTER__)                        \
+      = &::enum_strings::detail::describe<E>;                   \
+  }
+#else
+#define ENUM_STRINGS_HAVE_REGISTRY 0
+#define ENUM_STRINGS_DETAIL_REGISTER(E)
+#endif
+
+/**
+ * @brief Associate a list of string names with enumeration values.
+ * @param ENUM the enumeration type
+ * @param ... list of names (C-string literals)
+ *
+ * Conditions (not enforced but won't work correctly if violated):
+ *  - the macro must be called at namespace scope the enumeration type is defined in
+ *  - the number and order of string arguments passed must match the enum values
+ *  - enumeration constants must not have custom values assigned
+ *
+ *  If the enumeration has a special constant named @p END, it should be
+ *  the last one, and its value will be used to determine the number
+ *  of enum values and checked at compile time against number of strings.
+ */
+#define ENUM_STRINGS(E, ...)                                    \
+  static_assert(std::is_enum<E>::value,                         \
+                "Not an enumeration type");                     \
+                                                                \
+  inline constexpr auto _get_enum_strings(E)                    \
+  {                                                             \
+    return ::enum_strings::detail::make_table(#E, __VA_ARGS__); \
+  }                                                             \
+                                                                \
+  template <typename C, typename T>                             \
+  inline std::basic_ostream<C, T> &                             \
+  operator<<(std::basic_ostream<C, T> & os, E const e)          \
+  {                                                             \
+    return _write_enum_string(os, e,                            \
+      ::enum_strings::detail::stream_tag{});                    \
+  }                                                             \
+                                                                \
+  template <typename C, typename T>                             \
+  inline std::basic_istream<C, T> &                             \
+  operator>>(std::basic_istream<C, T> & is, E & e)              \
+  {                                                             \
+    return _read_enum_string(is, e,                             \
+      ::enum_strings::detail::stream_tag{});                    \
+  }                                                             \
+                                                                \
+  ENUM_STRINGS_DETAIL_REGISTER(E)                               \
+                                                                \
+  static_assert(::enum_strings::detail::check_num_values<E>(    \
+                  ::enum_strings::num_values<E>(), 0),          \
+                "Number of strings doesn't match number of enum"\
+                " values as determined by END enumeration value")
+
+/**
+ * @brief Declare that strings are associated with an enumeration, without providing them.
+ * @param E the enumeration type
+ *
+ * Use in headers in place of ENUM_STRINGS, with a matching ENUM_STRINGS_DEFINE in exactly
+ * one source file, so that the table, the lookup and the stream operators are compiled once.
+ * Conversions and num_values() work as usual, but at run time only: features that need the
+ * strings at compile time (e.g. JSON tables, enum_set) require ENUM_STRINGS.
+ */
+#define ENUM_STRINGS_DECLARE(E)                                 \
+  static_assert(std::is_enum<E>::value,                         \
+                "Not an enumeration type");                     \
+                                                                \
+  ::enum_strings::detail::extern_table const &                  \
+  _get_enum_strings(E) noexcept;                                \
+                                                                \
+  bool _find_enum_string(char const * s,                        \
+                         std::size_t length,                    \
+                         E & e) noexcept;                       \
+                                                                \
+  std::ostream & operator<<(std::ostream & os, E e);            \
+                                                                \
+  std::istream & operator>>(std::istream & is, E & e)
+
+/**
+ * @brief Define the strings of an enumeration declared with ENUM_STRINGS_DECLARE.
+ * @param E the enumeration type
+ * @param ... list of names (C-string literals)
+ *
+ * Must be called once in the program, at the same namespace scope as ENUM_STRINGS_DECLARE,
+ * under the same conditions as ENUM_STRINGS, after including enum_strings_iostream.h.
+ */
+#define ENUM_STRINGS_DEFINE(E, ...)                             \
+  inline constexpr auto _make_enum_strings(E)                   \
+  {                                                             \
+    return ::enum_strings::detail::make_table(#E, __VA_ARGS__); \
+  }                                                             \
+                                                                \
+  ::enum_strings::detail::extern_table const &                  \
+  _get_enum_strings(E) noexcept                                 \
+  {                                                             \
+    static constexpr auto table = _make_enum_strings(E{});      \
+    static constexpr ::enum_strings::detail::extern_table       \
+      result = { table.type_name,                               \
+                 ::enum_strings::detail::size<                  \
+                   decltype(table.strings)>::value,             \
+                 table.strings,                                 \
+                 table.lengths };                               \
+    return result;                                              \
+  }                                                             \
+                                                                \
+  bool _find_enum_string(char const * const s,                  \
+                         std::size_t const length,              \
+                         E & e) noexcept                        \
+  {                                                             \
+    return ::enum_strings::detail::find_string(s, length,      \
+                                               e, 0L);          \
+  }                                                             \
+                                                                \
+  std::ostream & operator<<(std::ostream & os, E const e)       \
+  {                                                             \
+    return _write_enum_string(os, e,                            \
+      ::enum_strings::detail::stream_tag{});                    \
+  }                                                             \
+                                                                \
+  std::istream & operator>>(std::istream & is, E & e)           \
+  {                                                             \
+    return _read_enum_string(is, e,                             \
+      ::enum_strings::detail::stream_tag{});                    \
+  }                                                             \
+                                                                \
+  ENUM_STRINGS_DETAIL_REGISTER(E)                               \
+                                                                \
+  static_assert(::enum_strings::detail::check_num_values<E>(    \
+                  ::enum_strings::detail::size<decltype(        \
+                    _make_enum_strings(E{}).strings)>::value,   \
+                  0),                                           \
+                "Number of strings doesn't match number of enum"\
+                " values as determined by END enumeration value")
+
+#endif //ENUM_STRINGS_MACROS_H
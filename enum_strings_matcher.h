@@ -0,0 +1,174 @@
+#ifndef ENUM_STRINGS_MATCHER_H
+#define ENUM_STRINGS_MATCHER_H
+
+/**
+ * @file enum_strings_matcher.h
+ * @author Sergey Klevtsov
+ */
+
+#include "enum_strings.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace enum_strings
+{
+
+namespace detail
+{
+
+template <std::size_t N>
+struct sorted_index
+{
+  std::uint32_t order[N];
+};
+
+/// Character of a name at a position, or -1 past its end (so that prefixes sort first)
+template <typename E>
+inline int char_at(std::size_t const index, std::size_t const pos)
+{
+  return pos < ::enum_strings::detail::get_lengths<E>()[index]
+       ? static_cast<unsigned char>(::enum_strings::detail::get_strings<E>()[index][pos])
+       : -1;
+}
+
+/**
+ * @brief Get the positions of the names of @p E in lexicographical order.
+ *
+ * Built on first use and stored in a function-local static, no allocation.
+ */
+template <typename E>
+inline auto const & get_sorted_index()
+{
+  static auto const index = []
+  {
+    sorted_index<::enum_strings::num_values<E>()> result{};
+    for (std::size_t i = 0; i < ::enum_strings::num_values<E>(); ++i)
+    {
+      result.order[i] = static_cast<std::uint32_t>(i);
+    }
+    std::sort(std::begin(result.order), std::end(result.order), [](std::uint32_t const a, std::uint32_t const b)
+    {
+      auto const & strings = ::enum_strings::detail::get_strings<E>();
+      auto const & lengths = ::enum_strings::detail::get_lengths<E>();
+      return std::lexicographical_compare(strings[a], strings[a] + lengths[a], strings[b], strings[b] + lengths[b],
+                                          [](char const x, char const y)
+                                          {
+                                            return static_cast<unsigned char>(x) < static_cast<unsigned char>(y);
+                                          });
+    });
+    return result;
+  }();
+  return index.order;
+}
+
+} // namespace detail
+
+/**
+ * @brief Matches a string against the names of an enumeration one character at a time.
+ * @tparam E type of enumeration
+ *
+ * The matcher keeps the range of names (in lexicographical order) that share
+ * the characters fed so far, narrowing it with a binary search on each
+ * character. It needs constant space regardless of input length, so a token
+ * split across several input buffers can be matched without copying it.
+ */
+template <typename E>
+class enum_matcher
+{
+public:
+
+  /**
+   * @brief Start matching a new string.
+   */
+  void reset() noexcept
+  {
+    m_lo = 0;
+    m_hi = ::enum_strings::num_values<E>();
+    m_pos = 0;
+  }
+
+  /**
+   * @brief Consume the next character.
+   * @param c the character
+   * @return @p true if some name still starts with the characters consumed so far
+   */
+  bool feed(char const c)
+  {
+    auto const & order = ::enum_strings::detail::get_sorted_index<E>();
+    int const key = static_cast<unsigned char>(c);
+    std::size_t const pos = m_pos;
+    auto const first = std::lower_bound(order + m_lo, order + m_hi, key, [pos](std::uint32_t const i, int const k)
+    {
+      return ::enum_strings::detail::char_at<E>(i, pos) < k;
+    });
+    auto const last = std::upper_bound(first, order + m_hi, key, [pos](int const k, std::uint32_t const i)
+    {
+      return k < ::enum_strings::detail::char_at<E>(i, pos);
+    });
+    m_lo = static_cast<std::size_t>(first - order);
+    m_hi = static_cast<std::size_t>(last - order);
+    ++m_pos;
+    return m_lo < m_hi;
+  }
+
+  /**
+   * @brief Consume a sequence of characters.
+   * @param s pointer to the characters
+   * @param length number of characters
+   * @return @p true if some name still starts with the characters consumed so far
+   */
+  bool feed(char const * const s, std::size_t const length)
+  {
+    for (std::size_t i = 0; i < length && m_lo < m_hi; ++i)
+    {
+      feed(s[i]);
+    }
+    return m_lo < m_hi;
+  }
+
+  /**
+   * @return @p true if some name starts with the characters consumed so far
+   */
+  bool viable() const noexcept
+  {
+    return m_lo < m_hi;
+  }
+
+  /**
+   * @return the number of characters consumed since the last reset
+   */
+  std::size_t size() const noexcept
+  {
+    return m_pos;
+  }
+
+  /**
+   * @brief Check if the characters consumed so far form a complete name.
+   * @param e the value to assign if they do
+   * @return @p true if a name matched, in which case @p e is assigned
+   */
+  bool match(E & e) const
+  {
+    if (m_lo < m_hi)
+    {
+      std::size_t const index = ::enum_strings::detail::get_sorted_index<E>()[m_lo];
+      if (::enum_strings::detail::get_lengths<E>()[index] == m_pos)
+      {
+        e = static_cast<E>(index);
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+
+  std::size_t m_lo = 0;
+  std::size_t m_hi = ::enum_strings::num_values<E>();
+  std::size_t m_pos = 0;
+};
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_MATCHER_H
@@ -0,0 +1,305 @@
+#ifndef ENUM_STRINGS_PARALLEL_H
+#define ENUM_STRINGS_PARALLEL_H
+
+/**
+ * @file enum_strings_parallel.h
+ * @author Sergey Klevtsov
+ *
+ * Requires linking with the platform thread library (Threads::Threads in CMake).
+ */
+
+#include "enum_strings.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace enum_strings
+{
+
+/**
+ * @brief Fixed set of threads that run the tasks of one job at a time.
+ *
+ * The thread calling run() takes part in the job, and tasks are claimed one by one
+ * from a shared counter, so threads that finish early keep taking work from the
+ * slower ones. Concurrent calls to run() are serialized; a task must not call run()
+ * on the same pool.
+ */
+class thread_pool
+{
+public:
+
+  /**
+   * @brief Construct a pool.
+   * @param threads number of threads taking part in a job, including the caller of run()
+   */
+  explicit thread_pool(unsigned const threads = std::thread::hardware_concurrency())
+  {
+    for (unsigned i = 1; i < threads; ++i)
+    {
+      m_threads.emplace_back([this] { work(); });
+    }
+  }
+
+  thread_pool(thread_pool const &) = delete;
+  thread_pool & operator=(thread_pool const &) = delete;
+
+  ~thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto & thread : m_threads)
+    {
+      thread.join();
+    }
+  }
+
+  /// Number of threads taking part in a job, including the caller of run()
+  unsigned size() const noexcept
+  {
+    return static_cast<unsigned>(m_threads.size()) + 1;
+  }
+
+  /**
+   * @brief Call @p f(i) for each i in <tt>[0, tasks)</tt> and wait for all calls to return.
+   * @exception any exception thrown by @p f, rethrown after all tasks are done
+   */
+  template <typename F>
+  void run(std::size_t const tasks, F && f)
+  {
+    if (m_threads.empty() || tasks <= 1)
+    {
+      for (std::size_t i = 0; i < tasks; ++i)
+      {
+        f(i);
+      }
+      return;
+    }
+
+    std::lock_guard<std::mutex> serial(m_run_mutex);
+    {
+      // Workers still leaving the previous job may be reading it
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_done.wait(lock, [this] { return m_active == 0; });
+      m_call = [](void * const context, std::size_t const i) { (*static_cast<std::remove_reference_t<F> *>(context))(i); };
+      m_context = &f;
+      m_tasks = tasks;
+      m_next.store(0, std::memory_order_relaxed);
+      ++m_generation;
+    }
+    m_wake.notify_all();
+    execute();
+
+    std::exception_ptr error;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_done.wait(lock, [this] { return m_active == 0; });
+      error = std::exchange(m_error, nullptr);
+    }
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+
+  /// Pool shared by the parallel conversions when none is given, with a thread per hardware thread
+  static thread_pool & global()
+  {
+    static thread_pool pool;
+    return pool;
+  }
+
+private:
+
+  void work()
+  {
+    std::uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+      m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+      if (m_stop)
+      {
+        return;
+      }
+      seen = m_generation;
+      ++m_active;
+      lock.unlock();
+      execute();
+      lock.lock();
+      if (--m_active == 0)
+      {
+        m_done.notify_all();
+      }
+    }
+  }
+
+  void execute()
+  {
+    for (std::size_t i; (i = m_next.fetch_add(1, std::memory_order_relaxed)) < m_tasks;)
+    {
+      try
+      {
+        m_call(m_context, i);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_error)
+        {
+          m_error = std::current_exception();
+        }
+      }
+    }
+  }
+
+  std::vector<std::thread> m_threads;
+  std::mutex m_run_mutex;
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  std::condition_variable m_done;
+  bool m_stop = false;
+  std::uint64_t m_generation = 0;
+  unsigned m_active = 0;
+
+  // The current job, only modified while no worker is active
+  void (* m_call)(void *, std::size_t) = nullptr;
+  void * m_context = nullptr;
+  std::size_t m_tasks = 0;
+  std::atomic<std::size_t> m_next{ 0 };
+  std::exception_ptr m_error;
+};
+
+namespace detail
+{
+
+/// Number of elements converted by one task; independent of the number of threads, so results are too
+constexpr std::size_t parallel_chunk = 16384;
+
+inline std::size_t parallel_chunks(std::size_t const n)
+{
+  return (n + parallel_chunk - 1) / parallel_chunk;
+}
+
+} // namespace detail
+
+/**
+ * @brief Convert an array of strings to enum values using a thread pool.
+ * @tparam E type of enumeration
+ * @tparam S string type with @p data() and @p size() (e.g. std::string, std::string_view, name_view)
+ * @param strings the strings to convert
+ * @param n number of strings
+ * @param out output array of @p n values; values at positions of invalid strings are left unchanged
+ * @param pool the threads to use
+ * @return the position of the first string not associated with @p E, or @p n if all are valid
+ */
+template <typename E, typename S>
+inline std::size_t parallel_from_strings(S const * const strings, std::size_t const n, E * const out,
+                                         thread_pool & pool = thread_pool::global())
+{
+  std::vector<std::size_t> first_invalid(::enum_strings::detail::parallel_chunks(n), n);
+  pool.run(first_invalid.size(), [&](std::size_t const chunk)
+  {
+    std::size_t const begin = chunk * ::enum_strings::detail::parallel_chunk;
+    std::size_t const end = std::min(begin + ::enum_strings::detail::parallel_chunk, n);
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      if (!::enum_strings::try_from_string(strings[i].data(), strings[i].size(), out[i]) && first_invalid[chunk] == n)
+      {
+        first_invalid[chunk] = i;
+      }
+    }
+  });
+  for (std::size_t const pos : first_invalid)
+  {
+    if (pos != n)
+    {
+      return pos;
+    }
+  }
+  return n;
+}
+
+/**
+ * @brief Convert an array of enum values to text using a thread pool.
+ * @tparam E type of enumeration
+ * @param values the values to convert
+ * @param n number of values
+ * @param delimiter string written after each name
+ * @param pool the threads to use
+ * @return the names of all values, each followed by @p delimiter
+ * @exception std::invalid_argument if any value is out of range (reported for the first one)
+ *
+ * The size of each chunk of output is computed first; chunks are then formatted
+ * in parallel directly at their offsets in the result, found by a prefix sum.
+ */
+template <typename E>
+inline std::string parallel_to_strings(E const * const values, std::size_t const n, char const * const delimiter = "\n",
+                                       thread_pool & pool = thread_pool::global())
+{
+  std::size_t const chunks = ::enum_strings::detail::parallel_chunks(n);
+  std::size_t const delimiter_length = std::strlen(delimiter);
+  std::vector<std::size_t> offsets(chunks + 1, 0);
+  std::vector<std::size_t> first_invalid(chunks, n);
+
+  pool.run(chunks, [&](std::size_t const chunk)
+  {
+    std::size_t const begin = chunk * ::enum_strings::detail::parallel_chunk;
+    std::size_t const end = std::min(begin + ::enum_strings::detail::parallel_chunk, n);
+    std::size_t size = 0;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      auto const index = static_cast<std::underlying_type_t<E>>(values[i]);
+      if (!::enum_strings::is_valid_code<E>(index))
+      {
+        first_invalid[chunk] = i;
+        break;
+      }
+      size += ::enum_strings::detail::get_lengths<E>()[index] + delimiter_length;
+    }
+    offsets[chunk + 1] = size;
+  });
+
+  for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+  {
+    if (first_invalid[chunk] != n)
+    {
+      ::enum_strings::detail::checked_index(values[first_invalid[chunk]]);
+    }
+    offsets[chunk + 1] += offsets[chunk];
+  }
+
+  std::string result(offsets[chunks], '\0');
+  char * const data = &result[0];
+  pool.run(chunks, [&](std::size_t const chunk)
+  {
+    std::size_t const begin = chunk * ::enum_strings::detail::parallel_chunk;
+    std::size_t const end = std::min(begin + ::enum_strings::detail::parallel_chunk, n);
+    char * p = data + offsets[chunk];
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      auto const index = static_cast<std::size_t>(values[i]);
+      std::size_t const length = ::enum_strings::detail::get_lengths<E>()[index];
+      std::memcpy(p, ::enum_strings::detail::get_strings<E>()[index], length);
+      std::memcpy(p + length, delimiter, delimiter_length);
+      p += length + delimiter_length;
+    }
+  });
+  return result;
+}
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_PARALLEL_H
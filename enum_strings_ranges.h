@@ -0,0 +1,96 @@
+#ifndef ENUM_STRINGS_RANGES_H
+#define ENUM_STRINGS_RANGES_H
+
+/**
+ * @file enum_strings_ranges.h
+ * @author Sergey Klevtsov
+ *
+ * Requires C++20.
+ */
+
+#include "enum_strings.h"
+
+#include <ranges>
+#include <string_view>
+
+namespace enum_strings
+{
+
+namespace detail
+{
+
+template <typename E>
+struct parse_fn
+{
+  template <typename R>
+  E operator()(R && r) const
+  {
+    if constexpr (std::is_convertible_v<R, std::string_view>)
+    {
+      std::string_view const s = r;
+      return ::enum_strings::from_string<E>(s.data(), s.size());
+    }
+    else
+    {
+      static_assert(std::ranges::contiguous_range<R> && std::ranges::sized_range<R>,
+                    "Elements must be strings or contiguous ranges of characters");
+      return ::enum_strings::from_string<E>(std::ranges::data(r), std::ranges::size(r));
+    }
+  }
+};
+
+struct name_fn
+{
+  template <typename E>
+  std::string_view operator()(E const e) const
+  {
+    std::size_t const index = ::enum_strings::detail::checked_index(e);
+    return { ::enum_strings::detail::get_strings<E>()[index], ::enum_strings::detail::get_lengths<E>()[index] };
+  }
+};
+
+template <typename E>
+struct value_fn
+{
+  constexpr E operator()(std::size_t const i) const noexcept
+  {
+    return static_cast<E>(i);
+  }
+};
+
+} // namespace detail
+
+namespace views
+{
+
+/**
+ * @brief Range adaptor converting strings to enum values on iteration.
+ * @tparam E type of enumeration
+ *
+ * Elements may be anything convertible to @p std::string_view, or contiguous
+ * ranges of characters such as the subranges produced by @p std::views::split.
+ * Conversion throws std::invalid_argument on unknown strings, like from_string().
+ */
+template <typename E>
+inline constexpr auto parse_enum = std::views::transform(::enum_strings::detail::parse_fn<E>{});
+
+/**
+ * @brief Range adaptor converting enum values to names (as @p std::string_view) on iteration.
+ *
+ * Conversion throws std::invalid_argument on out of range values, like to_string().
+ */
+inline constexpr auto enum_names = std::views::transform(::enum_strings::detail::name_fn{});
+
+/**
+ * @brief A view of all enum values associated with strings, in ascending order.
+ * @tparam E type of enumeration
+ */
+template <typename E>
+inline constexpr auto values = std::views::iota(std::size_t{0}, ::enum_strings::num_values<E>())
+                             | std::views::transform(::enum_strings::detail::value_fn<E>{});
+
+} // namespace views
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_RANGES_H
@@ -0,0 +1,130 @@
+#ifndef ENUM_STRINGS_REGISTRY_H
+#define ENUM_STRINGS_REGISTRY_H
+
+/**
+ * @file enum_strings_registry.h
+ * @author Sergey Klevtsov
+ *
+ * Listing of all enumerations registered with ENUM_STRINGS or ENUM_STRINGS_DEFINE. The
+ * registry is filled by the linker, not at startup, and is available where
+ * ENUM_STRINGS_HAVE_REGISTRY is 1 (GCC and Clang targeting ELF); elsewhere it is always empty.
+ *
+ * Each executable and shared library has its own registry, which registered_enums() reads
+ * for the module calling it. A shared library makes its registry available to others with
+ * ENUM_STRINGS_EXPORT_REGISTRY, and registered_enums() merges the ranges it is given.
+ */
+
+#include "enum_strings_core.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#if ENUM_STRINGS_HAVE_REGISTRY
+// Defined by the linker in every module that has entries; weak so that a module without any links too
+extern "C" ::enum_strings::detail::registry_entry const __start_enum_strings_registry[] __attribute__((weak, visibility("hidden")));
+extern "C" ::enum_strings::detail::registry_entry const __stop_enum_strings_registry[] __attribute__((weak, visibility("hidden")));
+
+// Hidden, so that a call from a module is never bound to the copy of another module
+#define ENUM_STRINGS_DETAIL_MODULE_LOCAL __attribute__((visibility("hidden")))
+#define ENUM_STRINGS_DETAIL_EXPORT __attribute__((visibility("default")))
+#else
+#define ENUM_STRINGS_DETAIL_MODULE_LOCAL
+#define ENUM_STRINGS_DETAIL_EXPORT
+#endif
+
+/**
+ * @brief Define a function returning the registry of the module (e.g. a shared library) it is defined in.
+ * @param NAME name of the function, declared elsewhere as <tt>enum_strings::registry_range NAME() noexcept;</tt>
+ *
+ * Must be called once per module, at global or namespace scope. The function is exported
+ * even when symbols are hidden by default.
+ */
+#define ENUM_STRINGS_EXPORT_REGISTRY(NAME)                      \
+  ENUM_STRINGS_DETAIL_EXPORT ::enum_strings::registry_range     \
+  NAME() noexcept                                               \
+  {                                                             \
+    return ::enum_strings::module_registry();                   \
+  }
+
+namespace enum_strings
+{
+
+/// Registry entries of one module
+struct registry_range
+{
+  ::enum_strings::detail::registry_entry const * first;
+  ::enum_strings::detail::registry_entry const * last;
+};
+
+/**
+ * @brief Get the registry of the module (executable or shared library) making the call.
+ * @return the range of its entries, empty if the module has none
+ */
+ENUM_STRINGS_DETAIL_MODULE_LOCAL inline registry_range module_registry() noexcept
+{
+#if ENUM_STRINGS_HAVE_REGISTRY
+  if (__start_enum_strings_registry != nullptr)
+  {
+    return { __start_enum_strings_registry, __stop_enum_strings_registry };
+  }
+#endif
+  return { nullptr, nullptr };
+}
+
+/**
+ * @brief List the enumerations registered in several modules.
+ * @param modules the registries to merge, e.g. module_registry() and those exported by shared libraries
+ * @return a description of each enumeration, ordered by type name; an enumeration registered
+ *         in several modules is listed once
+ */
+inline std::vector<registered_enum> registered_enums(std::initializer_list<registry_range> const modules)
+{
+  std::vector<registered_enum> result;
+  std::vector<::enum_strings::detail::registry_entry> entries;
+  for (registry_range const & module : modules)
+  {
+    // Each translation unit using a registration holds an entry for it
+    entries.assign(module.first, module.last);
+    std::sort(entries.begin(), entries.end(), std::less<::enum_strings::detail::registry_entry>{});
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+    // Another module lists an enumeration it shares with this one under the same name and
+    // fingerprint, through its own copy of describe<E>. Within a module, the same name and
+    // fingerprint can still be distinct enumerations of different namespaces.
+    auto const others_end = static_cast<std::ptrdiff_t>(result.size());
+    for (auto const entry : entries)
+    {
+      registered_enum const r = entry();
+      if (std::none_of(result.begin(), result.begin() + others_end, [&r](registered_enum const & other)
+      {
+        return other.fingerprint == r.fingerprint && std::strcmp(other.type_name, r.type_name) == 0;
+      }))
+      {
+        result.push_back(r);
+      }
+    }
+  }
+
+  std::sort(result.begin(), result.end(), [](registered_enum const & a, registered_enum const & b)
+  {
+    int const c = std::strcmp(a.type_name, b.type_name);
+    return c != 0 ? c < 0 : a.fingerprint < b.fingerprint;
+  });
+  return result;
+}
+
+/**
+ * @brief List the enumerations registered in the module (executable or shared library) making the call.
+ * @return a description of each enumeration, ordered by type name
+ */
+ENUM_STRINGS_DETAIL_MODULE_LOCAL inline std::vector<registered_enum> registered_enums()
+{
+  return ::enum_strings::registered_enums({ ::enum_strings::module_registry() });
+}
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_REGISTRY_H
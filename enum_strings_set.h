@@ -0,0 +1,153 @@
+#ifndef ENUM_STRINGS_SET_H
+#define ENUM_STRINGS_SET_H
+
+/**
+ * @file enum_strings_set.h
+ * @author Sergey Klevtsov
+ */
+
+#include "enum_strings.h"
+
+#include <cstdint>
+#include <initializer_list>
+
+namespace enum_strings
+{
+
+/**
+ * @brief A fixed-size bit set of enumeration values.
+ * @tparam E type of enumeration
+ *
+ * Storage is sized from num_values<E>() at compile time, one bit per value.
+ * The set never allocates and is trivially copyable.
+ */
+template <typename E>
+class enum_set
+{
+public:
+
+  using word_type = std::uint64_t;
+
+  static constexpr std::size_t bits_per_word = 64;
+  static constexpr std::size_t num_words = (::enum_strings::num_values<E>() + bits_per_word - 1) / bits_per_word;
+
+  constexpr enum_set() noexcept = default;
+
+  enum_set(std::initializer_list<E> values) noexcept
+  {
+    for (E const e : values)
+    {
+      insert(e);
+    }
+  }
+
+  /**
+   * @brief Add a value to the set.
+   * @param e the value to add (must be in the registered range)
+   */
+  void insert(E const e) noexcept
+  {
+    auto const i = index(e);
+    m_words[i / bits_per_word] |= word_type{1} << (i % bits_per_word);
+  }
+
+  /**
+   * @brief Remove a value from the set.
+   * @param e the value to remove (must be in the registered range)
+   */
+  void erase(E const e) noexcept
+  {
+    auto const i = index(e);
+    m_words[i / bits_per_word] &= ~(word_type{1} << (i % bits_per_word));
+  }
+
+  /**
+   * @brief Check whether a value is in the set.
+   * @param e the value to check (must be in the registered range)
+   * @return @p true if the value is in the set
+   */
+  bool contains(E const e) const noexcept
+  {
+    auto const i = index(e);
+    return (m_words[i / bits_per_word] >> (i % bits_per_word)) & 1;
+  }
+
+  /**
+   * @return the number of values in the set
+   */
+  std::size_t size() const noexcept
+  {
+    std::size_t n = 0;
+    for (word_type w : m_words)
+    {
+      for (; w != 0; w &= w - 1, ++n);
+    }
+    return n;
+  }
+
+  bool empty() const noexcept
+  {
+    for (word_type const w : m_words)
+    {
+      if (w != 0) return false;
+    }
+    return true;
+  }
+
+  void clear() noexcept
+  {
+    for (word_type & w : m_words)
+    {
+      w = 0;
+    }
+  }
+
+  /**
+   * @brief Invoke a function on each value in the set, in ascending order.
+   * @param f the function to call with each value
+   */
+  template <typename F>
+  void for_each(F && f) const
+  {
+    for (std::size_t i = 0; i < ::enum_strings::num_values<E>(); ++i)
+    {
+      if ((m_words[i / bits_per_word] >> (i % bits_per_word)) & 1)
+      {
+        f(static_cast<E>(i));
+      }
+    }
+  }
+
+  /**
+   * @return the underlying words, bit @p i of the set is bit <tt>i % 64</tt> of word <tt>i / 64</tt>
+   */
+  word_type const * words() const noexcept { return m_words; }
+  word_type * words() noexcept { return m_words; }
+
+  friend bool operator==(enum_set const & lhs, enum_set const & rhs) noexcept
+  {
+    for (std::size_t i = 0; i < num_words; ++i)
+    {
+      if (lhs.m_words[i] != rhs.m_words[i]) return false;
+    }
+    return true;
+  }
+
+  friend bool operator!=(enum_set const & lhs, enum_set const & rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+private:
+
+  static std::size_t index(E const e) noexcept
+  {
+    return static_cast<std::size_t>(static_cast<std::underlying_type_t<E>>(e));
+  }
+
+  word_type m_words[num_words == 0 ? 1 : num_words] {};
+};
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_SET_H
@@ -0,0 +1,306 @@
+#ifndef ENUM_STRINGS_STRING_H
+#define ENUM_STRINGS_STRING_H
+
+/**
+ * @file enum_strings_string.h
+ * @author Sergey Klevtsov
+ */
+
+#include "enum_strings_core.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if __cplusplus >= 201703L && __has_include(<memory_resource>)
+#include <memory_resource>
+#define ENUM_STRINGS_HAVE_PMR 1
+#endif
+
+namespace enum_strings
+{
+
+namespace detail
+{
+
+/// Exception message built on the stack, so that the exception object makes the only allocation
+class message_buffer
+{
+public:
+
+  /// Append characters, ending the message with "..." if they do not fit
+  message_buffer & append(char const * const s, std::size_t const n) noexcept
+  {
+    if (n <= capacity - m_size)
+    {
+      std::memcpy(m_data + m_size, s, n);
+      m_size += n;
+    }
+    else if (m_size < capacity)
+    {
+      std::memcpy(m_data + m_size, s, capacity - m_size);
+      std::memcpy(m_data + capacity - 3, "...", 3);
+      m_size = capacity;
+    }
+    m_data[m_size] = '\0';
+    return *this;
+  }
+
+  /// Append at most @p max characters of a user-provided string, marking truncation
+  message_buffer & append_quoted(char const * const s, std::size_t const n, std::size_t const max = 128) noexcept
+  {
+    append("'", 1);
+    append(s, n < max ? n : max);
+    return n < max ? append("'", 1) : append("...'", 4);
+  }
+
+  message_buffer & operator<<(char const * const s) noexcept
+  {
+    return append(s, std::strlen(s));
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_integral<T>::value, message_buffer &> operator<<(T const value) noexcept
+  {
+    char buf[24];
+    char * p = buf + sizeof(buf);
+    bool const negative = value < T{};
+    auto v = negative ? 0 - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+    do { *--p = static_cast<char>('0' + v % 10); v /= 10; } while (v != 0);
+    if (negative) *--p = '-';
+    return append(p, static_cast<std::size_t>(buf + sizeof(buf) - p));
+  }
+
+  char const * c_str() const noexcept { return m_data; }
+
+  static constexpr std::size_t capacity = 255;
+
+private:
+
+  char m_data[capacity + 1] = {};
+  std::size_t m_size = 0;
+};
+
+/// Names joined with ", " for error messages, built at compile time up to the length a message can hold
+template <typename E>
+struct joined_storage
+{
+  static constexpr std::size_t length = ::enum_strings::detail::joined_length<E, 3>(message_buffer::capacity);
+  using type = ::enum_strings::char_array<length + 1>;
+  static constexpr type value = ::enum_strings::detail::join_names<E, length>(", ");
+};
+
+#if __cplusplus < 201703L
+template <typename E>
+constexpr typename joined_storage<E>::type joined_storage<E>::value;
+#endif
+
+template <typename E>
+inline void append_names(message_buffer & msg, std::false_type)
+{
+  using storage = ::enum_strings::detail::joined_storage<E>;
+  msg.append(storage::value.c_str(), storage::length);
+}
+
+/// Names of enumerations defined in another translation unit are only known at run time
+template <typename E>
+inline void append_names(message_buffer & msg, std::true_type)
+{
+  for (std::size_t i = 0; i < ::enum_strings::num_values<E>(); ++i)
+  {
+    msg.append(", ", i > 0 ? 2 : 0).append(::enum_strings::detail::get_strings<E>()[i], ::enum_strings::detail::get_lengths<E>()[i]);
+  }
+}
+
+/// Append the list of valid names of @p E to an error message
+template <typename E>
+inline message_buffer & append_names(message_buffer & msg)
+{
+  ::enum_strings::detail::append_names<E>(msg, ::enum_strings::detail::is_extern<E>{});
+  return msg;
+}
+
+/// Throw std::invalid_argument for a numerical value of @p E that has no string
+template <typename E, typename T>
+[[noreturn]] inline void throw_invalid_value(T const value)
+{
+  message_buffer msg;
+  msg << "Invalid value " << value << ". Valid range is 0.." << (::enum_strings::num_values<E>() - 1) << " (";
+  ::enum_strings::detail::append_names<E>(msg) << ")";
+  throw std::invalid_argument(msg.c_str());
+}
+
+/// Index of @p e in the string table, throws std::invalid_argument if out of range
+template<typename E>
+inline std::size_t checked_index(E const e)
+{
+  auto const index = static_cast<std::underlying_type_t<E>>(e);
+  if (!::enum_strings::is_valid_code<E>(index))
+  {
+    // Widened so that stream input of numeric codes shares the instantiation
+    using wide_type = std::conditional_t<std::is_signed<decltype(index)>::value, long long, unsigned long long>;
+    ::enum_strings::detail::throw_invalid_value<E>(static_cast<wide_type>(index));
+  }
+  return static_cast<std::size_t>(index);
+}
+
+template <typename Alloc, typename T>
+using rebind_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+
+} // namespace detail
+
+/**
+ * @brief Convert enum to string.
+ * @tparam E type of enumeration
+ * @param e the enum value to convert
+ * @return the corresponding string
+ * @exception std::invalid_argument if numerical value of @p e is negative or greater of equal than the number of strings.
+ */
+template<typename E>
+inline std::string to_string(E const e)
+{
+  auto const & strings = ::enum_strings::detail::get_strings<E>();
+  return strings[::enum_strings::detail::checked_index(e)];
+}
+
+/**
+ * @brief Convert enum to string allocated with a custom allocator.
+ * @tparam E type of enumeration
+ * @tparam Alloc allocator type (of @p char)
+ * @param e the enum value to convert
+ * @param alloc the allocator to use
+ * @return the corresponding string
+ * @exception std::invalid_argument if numerical value of @p e is negative or greater of equal than the number of strings.
+ */
+template <typename E, typename Alloc, typename = std::enable_if_t<!std::is_pointer<Alloc>::value>>
+inline std::basic_string<char, std::char_traits<char>, Alloc> to_string(E const e, Alloc const & alloc)
+{
+  std::size_t const index = ::enum_strings::detail::checked_index(e);
+  return { ::enum_strings::detail::get_strings<E>()[index], ::enum_strings::detail::get_lengths<E>()[index], alloc };
+}
+
+/**
+ * @brief Convert string to enum without throwing or allocating.
+ * @tparam E type of enumeration
+ * @param s the string to convert
+ * @param e the value to assign if the string is found
+ * @return @p true if @p s is a string associated with given enum type, in which case @p e is assigned
+ */
+template <typename E>
+inline bool try_from_string(std::string const & s, E & e) noexcept
+{
+  return ::enum_strings::try_from_string(s.data(), s.size(), e);
+}
+
+/**
+ * @brief Convert string to enum
+ * @tparam E type of enumeration
+ * @param s pointer to the characters of the string (need not be null-terminated)
+ * @param length number of characters
+ * @return the corresponding enum value
+ * @exception std::invalid_argument if @p s is not a string associated with give enum type
+ */
+template <typename E>
+inline E from_string(char const * const s, std::size_t const length)
+{
+  E e{};
+  if (!::enum_strings::try_from_string(s, length, e))
+  {
+    ::enum_strings::detail::message_buffer msg;
+    msg.append_quoted(s, length) << " is not a valid string representation of this type. Valid values are: ";
+    ::enum_strings::detail::append_names<E>(msg);
+    throw std::invalid_argument(msg.c_str());
+  }
+  return e;
+}
+
+/**
+ * @brief Convert string to enum
+ * @tparam E type of enumeration
+ * @param s the string to convert
+ * @return the corresponding enum value
+ * @exception std::invalid_argument if @p s is not a string associated with give enum type
+ */
+template <typename E>
+inline E from_string(std::string const & s)
+{
+  return ::enum_strings::from_string<E>(s.data(), s.size());
+}
+
+/**
+ * @brief Convert null-terminated string to enum
+ * @tparam E type of enumeration
+ * @param s the string to convert
+ * @return the corresponding enum value
+ * @exception std::invalid_argument if @p s is not a string associated with give enum type
+ */
+template <typename E>
+inline E from_string(char const * const s)
+{
+  return ::enum_strings::from_string<E>(s, std::strlen(s));
+}
+
+/**
+ * @brief Get the enumeration strings as a vector
+ * @tparam E type of enumeration
+ * @return a vector of <tt>std::string</tt>'s associated with @p E's values
+ */
+template <typename E>
+inline std::vector<std::string> get_strings()
+{
+  auto const & strings = ::enum_strings::detail::get_strings<E>();
+  return std::vector<std::string>(strings, strings + ::enum_strings::num_values<E>());
+}
+
+/**
+ * @brief Get the enumeration strings as a vector allocated with a custom allocator.
+ * @tparam E type of enumeration
+ * @tparam Alloc allocator type (of @p char), rebound for the vector
+ * @param alloc the allocator to use for the vector and each string
+ * @return a vector of strings associated with @p E's values
+ */
+template <typename E, typename Alloc, typename = std::enable_if_t<!std::is_pointer<Alloc>::value>>
+inline auto get_strings(Alloc const & alloc)
+{
+  using string_type = std::basic_string<char, std::char_traits<char>, Alloc>;
+  std::vector<string_type, ::enum_strings::detail::rebind_alloc<Alloc, string_type>> result(alloc);
+  result.reserve(::enum_strings::num_values<E>());
+  for (std::size_t i = 0; i < ::enum_strings::num_values<E>(); ++i)
+  {
+    result.push_back(string_type(::enum_strings::detail::get_strings<E>()[i], ::enum_strings::detail::get_lengths<E>()[i], alloc));
+  }
+  return result;
+}
+
+#if ENUM_STRINGS_HAVE_PMR
+/**
+ * @brief Convert enum to string allocated from a memory resource (e.g. a monotonic arena).
+ * @tparam E type of enumeration
+ * @param e the enum value to convert
+ * @param resource the memory resource to allocate from
+ * @return the corresponding string
+ * @exception std::invalid_argument if numerical value of @p e is negative or greater of equal than the number of strings.
+ */
+template <typename E>
+inline std::pmr::string to_string(E const e, std::pmr::memory_resource * const resource)
+{
+  return ::enum_strings::to_string(e, std::pmr::polymorphic_allocator<char>(resource));
+}
+
+/**
+ * @brief Get the enumeration strings as a vector allocated from a memory resource (e.g. a monotonic arena).
+ * @tparam E type of enumeration
+ * @param resource the memory resource to allocate the vector and each string from
+ * @return a vector of strings associated with @p E's values
+ */
+template <typename E>
+inline std::pmr::vector<std::pmr::string> get_strings(std::pmr::memory_resource * const resource)
+{
+  return ::enum_strings::get_strings<E>(std::pmr::polymorphic_allocator<char>(resource));
+}
+#endif
+
+} //namespace enum_strings
+
+#endif //ENUM_STRINGS_STRING_H
@@ -0,0 +1,206 @@
+#ifndef ENUM_STRINGS_TIMELINE_H
+#define ENUM_STRINGS_TIMELINE_H
+
+/**
+ * @file enum_strings_timeline.h
+ * @author Sergey Klevtsov
+ */
+
+#include "enum_strings.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace enum_strings
+{
+
+/**
+ * @brief A run-length encoded sequence of enumeration values.
+ * @tparam E type of enumeration
+ *
+ * Consecutive equal values are stored once with a repeat count, so highly
+ * repetitive sequences (e.g. per-sample state machine states) take space
+ * proportional to the number of state changes. Every @p block_runs runs the
+ * starting sample position is recorded in a sparse index, which gives
+ * O(log n) random access without storing per-run positions.
+ */
+template <typename E>
+class enum_timeline
+{
+public:
+
+  using length_type = std::uint32_t;
+
+  static constexpr std::size_t block_runs = 64;
+
+  /**
+   * @brief Append a value repeated a number of times.
+   * @param e the value to append
+   * @param count number of repetitions
+   * @exception std::invalid_argument if numerical value of @p e is negative or greater of equal than the number of strings.
+   */
+  void push_back(E const e, std::size_t count = 1)
+  {
+    ::enum_strings::detail::checked_index(e);
+    m_size += count;
+    if (count > 0 && !m_values.empty() && m_values.back() == e)
+    {
+      std::size_t const room = std::numeric_limits<length_type>::max() - m_lengths.back();
+      std::size_t const n = std::min(room, count);
+      m_lengths.back() += static_cast<length_type>(n);
+      count -= n;
+    }
+    for (std::size_t start = m_size - count; count > 0;)
+    {
+      std::size_t const n = std::min<std::size_t>(std::numeric_limits<length_type>::max(), count);
+      if (m_values.size() % block_runs == 0)
+      {
+        m_block_starts.push_back(start);
+      }
+      m_values.push_back(e);
+      m_lengths.push_back(static_cast<length_type>(n));
+      start += n;
+      count -= n;
+    }
+  }
+
+  /**
+   * @return the number of samples in the sequence
+   */
+  std::size_t size() const noexcept { return m_size; }
+
+  bool empty() const noexcept { return m_size == 0; }
+
+  /**
+   * @return the number of stored runs
+   */
+  std::size_t num_runs() const noexcept { return m_values.size(); }
+
+  E run_value(std::size_t const r) const { return m_values[r]; }
+
+  length_type run_length(std::size_t const r) const { return m_lengths[r]; }
+
+  void clear() noexcept
+  {
+    m_values.clear();
+    m_lengths.clear();
+    m_block_starts.clear();
+    m_size = 0;
+  }
+
+  /**
+   * @brief Get a sample by position.
+   * @param i sample position
+   * @return the value of the sample
+   * @exception std::out_of_range if @p i is not less than size()
+   */
+  E at(std::size_t const i) const
+  {
+    if (i >= m_size)
+    {
+      throw std::out_of_range("Sample " + std::to_string(i) + " is out of range, the timeline has " + std::to_string(m_size) + " samples");
+    }
+    return m_values[find(i).first];
+  }
+
+  E operator[](std::size_t const i) const
+  {
+    return m_values[find(i).first];
+  }
+
+  /**
+   * @brief Decode a range of samples into a dense array.
+   * @param first position of the first sample
+   * @param count number of samples (first + count must not exceed size())
+   * @param out output array of @p count values
+   */
+  void decode(std::size_t const first, std::size_t count, E * out) const
+  {
+    if (count == 0) return;
+    auto pos = find(first);
+    std::size_t n = std::min<std::size_t>(m_lengths[pos.first] - (first - pos.second), count);
+    for (std::size_t r = pos.first; ; n = std::min<std::size_t>(m_lengths[++r], count))
+    {
+      out = std::fill_n(out, n, m_values[r]);
+      count -= n;
+      if (count == 0) break;
+    }
+  }
+
+  /**
+   * @brief Compute the number of samples spent in each value, without decoding.
+   * @param first position of the first sample
+   * @param count number of samples (first + count must not exceed size())
+   * @param totals output array of num_values<E>() counters, overwritten
+   */
+  void durations(std::size_t const first, std::size_t count, std::uint64_t * const totals) const
+  {
+    std::fill_n(totals, ::enum_strings::num_values<E>(), std::uint64_t{0});
+    if (count == 0) return;
+    auto pos = find(first);
+    std::size_t n = std::min<std::size_t>(m_lengths[pos.first] - (first - pos.second), count);
+    for (std::size_t r = pos.first; ; n = std::min<std::size_t>(m_lengths[++r], count))
+    {
+      totals[index(m_values[r])] += n;
+      count -= n;
+      if (count == 0) break;
+    }
+  }
+
+  /**
+   * @brief Compute the number of samples spent in each value over the whole sequence.
+   * @param totals output array of num_values<E>() counters, overwritten
+   */
+  void durations(std::uint64_t * const totals) const
+  {
+    std::fill_n(totals, ::enum_strings::num_values<E>(), std::uint64_t{0});
+    for (std::size_t r = 0; r < m_values.size(); ++r)
+    {
+      totals[index(m_values[r])] += m_lengths[r];
+    }
+  }
+
+  /**
+   * @brief Print runs as space-separated <tt>name:count</tt> pairs.
+   */
+  friend std::ostream & operator<<(std::ostream & os, enum_timeline const & t)
+  {
+    auto const & strings = ::enum_strings::detail::get_strings<E>();
+    for (std::size_t r = 0; r < t.m_values.size(); ++r)
+    {
+      if (r > 0) os << ' ';
+      os << strings[index(t.m_values[r])] << ':' << t.m_lengths[r];
+    }
+    return os;
+  }
+
+private:
+
+  static std::size_t index(E const e) noexcept
+  {
+    return static_cast<std::size_t>(static_cast<std::underlying_type_t<E>>(e));
+  }
+
+  /// Find the run containing sample @p i, returns run index and its starting sample
+  std::pair<std::size_t, std::size_t> find(std::size_t const i) const noexcept
+  {
+    std::size_t const b = static_cast<std::size_t>(std::upper_bound(m_block_starts.begin(), m_block_starts.end(), i) - m_block_starts.begin()) - 1;
+    std::size_t r = b * block_runs;
+    std::size_t start = m_block_starts[b];
+    for (; start + m_lengths[r] <= i; start += m_lengths[r++]);
+    return { r, start };
+  }
+
+  std::vector<E> m_values;
+  std::vector<length_type> m_lengths;
+  std::vector<std::size_t> m_block_starts;
+  std::size_t m_size = 0;
+};
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_TIMELINE_H
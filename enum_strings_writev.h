@@ -0,0 +1,199 @@
+#ifndef ENUM_STRINGS_WRITEV_H
+#define ENUM_STRINGS_WRITEV_H
+
+/**
+ * @file enum_strings_writev.h
+ * @author Sergey Klevtsov
+ *
+ * POSIX only.
+ */
+
+#include "enum_strings.h"
+
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <system_error>
+
+#include <sys/uio.h>
+
+namespace enum_strings
+{
+
+/**
+ * @brief Writes enumeration names to a file descriptor without copying them.
+ * @tparam E type of enumeration
+ *
+ * Each name is passed to @p writev as an @p iovec pointing directly at the
+ * registered string literal, followed by a delimiter. Names shorter than
+ * the copy threshold (and delimiters) are instead coalesced into an internal
+ * buffer, since an @p iovec entry per few bytes costs more than the copy.
+ * Pending output is flushed in batches of at most @p IOV_MAX entries.
+ *
+ * The file descriptor is expected to be in blocking mode.
+ * The destructor flushes, ignoring errors; call flush() to observe them.
+ */
+template <typename E>
+class enum_writer
+{
+public:
+
+#ifdef IOV_MAX
+  static constexpr std::size_t max_iov = IOV_MAX;
+#else
+  static constexpr std::size_t max_iov = 1024;
+#endif
+
+  static constexpr std::size_t buffer_size = 16384;
+
+  /**
+   * @brief Construct a writer.
+   * @param fd the file descriptor to write to
+   * @param delimiter string written after each name (must outlive the writer)
+   * @param copy_threshold names shorter than this are copied rather than referenced
+   */
+  explicit enum_writer(int const fd,
+                       char const * const delimiter = "\n",
+                       std::size_t const copy_threshold = 16)
+    : m_fd(fd),
+      m_delimiter(delimiter),
+      m_delimiter_length(std::strlen(delimiter)),
+      m_copy_threshold(copy_threshold)
+  {}
+
+  enum_writer(enum_writer const &) = delete;
+  enum_writer & operator=(enum_writer const &) = delete;
+
+  ~enum_writer()
+  {
+    try
+    {
+      flush();
+    }
+    catch (...)
+    {}
+  }
+
+  /**
+   * @brief Write one name followed by the delimiter.
+   * @param e the value to write
+   * @exception std::invalid_argument if @p e is out of range
+   * @exception std::system_error if a write fails
+   */
+  void write(E const e)
+  {
+    std::size_t const index = ::enum_strings::detail::checked_index(e);
+    std::size_t const length = ::enum_strings::detail::get_lengths<E>()[index];
+    char const * const name = ::enum_strings::detail::get_strings<E>()[index];
+    if (length < m_copy_threshold)
+    {
+      append_copy(name, length);
+    }
+    else
+    {
+      append_ref(name, length);
+    }
+    append_copy(m_delimiter, m_delimiter_length);
+  }
+
+  /**
+   * @brief Write names of an array of values, each followed by the delimiter.
+   * @param values the values to write
+   * @param n number of values
+   * @exception std::invalid_argument if any value is out of range
+   * @exception std::system_error if a write fails
+   */
+  void write(E const * const values, std::size_t const n)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      write(values[i]);
+    }
+  }
+
+  /**
+   * @brief Write all pending output.
+   * @exception std::system_error if a write fails
+   */
+  void flush()
+  {
+    iovec * iov = m_iov;
+    std::size_t count = m_iovcnt;
+    m_iovcnt = 0;
+    m_used = 0;
+    m_open = false;
+    while (count > 0)
+    {
+      int const batch = static_cast<int>(count < max_iov ? count : max_iov);
+      ssize_t written = ::writev(m_fd, iov, batch);
+      if (written < 0)
+      {
+        if (errno == EINTR) continue;
+        throw std::system_error(errno, std::generic_category(), "writev");
+      }
+      if (written == 0 && iov->iov_len != 0)
+      {
+        // no progress on a non-empty batch: retrying would spin forever
+        throw std::system_error(EIO, std::generic_category(), "writev");
+      }
+      // skip fully written entries and adjust a partially written one
+      for (; count > 0 && static_cast<std::size_t>(written) >= iov->iov_len; ++iov, --count)
+      {
+        written -= static_cast<ssize_t>(iov->iov_len);
+      }
+      if (written > 0)
+      {
+        iov->iov_base = static_cast<char *>(iov->iov_base) + written;
+        iov->iov_len -= static_cast<std::size_t>(written);
+      }
+    }
+  }
+
+private:
+
+  void append_ref(char const * const s, std::size_t const len)
+  {
+    if (m_iovcnt == max_iov)
+    {
+      flush();
+    }
+    m_iov[m_iovcnt++] = { const_cast<char *>(s), len };
+    m_open = false;
+  }
+
+  void append_copy(char const * const s, std::size_t const len)
+  {
+    if (len > buffer_size)
+    {
+      append_ref(s, len);
+      return;
+    }
+    if (m_used + len > buffer_size || (!m_open && m_iovcnt == max_iov))
+    {
+      flush();
+    }
+    if (!m_open)
+    {
+      m_iov[m_iovcnt++] = { m_buffer + m_used, 0 };
+      m_open = true;
+    }
+    std::memcpy(m_buffer + m_used, s, len);
+    m_used += len;
+    m_iov[m_iovcnt - 1].iov_len += len;
+  }
+
+  int m_fd;
+  char const * m_delimiter;
+  std::size_t m_delimiter_length;
+  std::size_t m_copy_threshold;
+
+  iovec m_iov[max_iov];
+  std::size_t m_iovcnt = 0;
+  char m_buffer[buffer_size];
+  std::size_t m_used = 0;
+  bool m_open = false; ///< whether the last iovec points into the buffer and can be extended
+};
+
+} // namespace enum_strings
+
+#endif //ENUM_STRINGS_WRITEV_H
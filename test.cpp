@@ -10,6 +10,17 @@ void test_to_from_string(E const e, std::string const s)
   assert(enum_strings::from_string<E>(s) == e);
 }
 
+template <typename E>
+void test_try_from_string(E const e, std::string const s)
+{
+  E v = static_cast<E>(0);
+  assert(enum_strings::try_from_string(s, v) && v == e);
+  assert(enum_strings::from_string<E>(s.c_str()) == e);
+  assert(enum_strings::from_string<E>((s + "xyz").data(), s.size()) == e);
+  assert(!enum_strings::try_from_string((s + "xyz").data(), s.size() + 1, v) && v == e);
+  assert(!enum_strings::try_from_string(s.data(), s.size() - 1, v) && v == e);
+}
+
 template <typename E>
 void test_stream_io(E const e)
 {
@@ -18,6 +29,14 @@ void test_stream_io(E const e)
   E v;
   ss >> v;
   assert(v == e);
+
+  // numeric codes, until switched back to names
+  std::stringstream codes;
+  codes << enum_strings::numeric << e << ' ' << enum_strings::names << e;
+  assert(codes.str() == std::to_string(static_cast<int>(e)) + ' ' + enum_strings::to_string(e));
+  E n, m;
+  codes >> enum_strings::numeric >> n >> enum_strings::names >> m;
+  assert(n == e && m == e);
 }
 
 template <typename E, typename ... ARGS>
@@ -27,6 +46,46 @@ void test_get_strings(ARGS && ... args)
   assert(::enum_strings::get_strings<E>() == expected);
 }
 
+template <typename E>
+void test_invalid_to_string(std::underlying_type_t<E> const code)
+{
+  bool thrown = false;
+  try
+  {
+    enum_strings::to_string(static_cast<E>(code));
+  }
+  catch (std::invalid_argument const &)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+}
+
+template <typename E>
+void test_validate_codes(std::vector<std::underlying_type_t<E>> codes, std::size_t const first_invalid)
+{
+  std::size_t const n = codes.size();
+  assert(enum_strings::validate_codes<E>(codes.data(), n) == first_invalid);
+
+  std::vector<std::uint64_t> mask((n + 63) / 64);
+  std::size_t const count = enum_strings::validate_codes<E>(codes.data(), n, mask.data());
+  std::size_t expected = 0;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    bool const invalid = !enum_strings::is_valid_code<E>(codes[i]);
+    assert(((mask[i / 64] >> (i % 64)) & 1) == invalid);
+    expected += invalid;
+  }
+  assert(count == expected);
+
+  std::vector<E> out(n, static_cast<E>(0));
+  assert(enum_strings::convert_codes<E>(codes.data(), n, out.data()) == first_invalid);
+  for (std::size_t i = 0; i < n && first_invalid == n; ++i)
+  {
+    assert(static_cast<std::underlying_type_t<E>>(out[i]) == codes[i]);
+  }
+}
+
 ///////////////////////////////
 
 namespace N1
@@ -56,21 +115,56 @@ int main()
 {
   test_to_from_string(N1::A, "wa");
   test_to_from_string(N1::B, "wb");
+  test_try_from_string(N1::B, "wb");
   test_stream_io(N1::A);
   test_stream_io(N1::B);
   test_get_strings<N1::WeakEnum>("wa", "wb");
 
   test_to_from_string(N2::StrongEnum::A, "sa");
   test_to_from_string(N2::StrongEnum::B, "sb");
+  test_try_from_string(N2::StrongEnum::A, "sa");
   test_stream_io(N2::StrongEnum::A);
   test_stream_io(N2::StrongEnum::B);
   test_get_strings<N2::StrongEnum>("sa", "sb");
 
   test_to_from_string(N3::Foo::NestedEnum::A, "fa");
   test_to_from_string(N3::Foo::NestedEnum::B, "fb");
+  test_try_from_string(N3::Foo::NestedEnum::B, "fb");
   test_stream_io(N3::Foo::NestedEnum::A);
   test_stream_io(N3::Foo::NestedEnum::B);
   test_get_strings<N3::Foo::NestedEnum>("fa", "fb");
 
+  assert(std::string(enum_strings::type_name<N1::WeakEnum>()) == "WeakEnum");
+  assert(std::string(enum_strings::type_name<N3::Foo::NestedEnum>()) == "Foo::NestedEnum");
+  static_assert(enum_strings::fingerprint<N1::WeakEnum>() != enum_strings::fingerprint<N2::StrongEnum>(), "");
+
+  test_invalid_to_string<N1::WeakEnum>(2);
+  test_invalid_to_string<N2::StrongEnum>(-1);
+  test_invalid_to_string<N2::StrongEnum>(2);
+
+  {
+    std::stringstream ss("7");
+    N2::StrongEnum v = N2::StrongEnum::B;
+    bool thrown = false;
+    try
+    {
+      ss >> enum_strings::numeric >> v;
+    }
+    catch (std::invalid_argument const &)
+    {
+      thrown = true;
+    }
+    assert(thrown && v == N2::StrongEnum::B);
+  }
+
+  std::vector<int16_t> codes(200, 1);
+  test_validate_codes<N2::StrongEnum>(codes, 200);
+  codes[130] = -1;
+  codes[150] = 2;
+  test_validate_codes<N2::StrongEnum>(codes, 130);
+  codes[3] = 1000;
+  test_validate_codes<N2::StrongEnum>(codes, 3);
+  test_validate_codes<N2::StrongEnum>({}, 0);
+
   return 0;
 }
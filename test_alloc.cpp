@@ -0,0 +1,166 @@
+#include "enum_strings.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <streambuf>
+
+// Count every allocation made through the global operator new
+
+namespace
+{
+  std::size_t allocations = 0;
+}
+
+void * operator new(std::size_t const n)
+{
+  ++allocations;
+  if (void * const p = std::malloc(n != 0 ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void * operator new[](std::size_t const n)
+{
+  return ::operator new(n);
+}
+
+void operator delete(void * const p) noexcept { std::free(p); }
+void operator delete[](void * const p) noexcept { std::free(p); }
+void operator delete(void * const p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void * const p, std::size_t) noexcept { std::free(p); }
+
+template <typename F>
+std::size_t count_allocations(F && f)
+{
+  std::size_t const before = allocations;
+  f();
+  return allocations - before;
+}
+
+namespace N1
+{
+  enum class Small { a, b, c, END };
+  ENUM_STRINGS(Small, "a", "bb", "ccc");
+
+  enum class Large
+  {
+    v0, v1, v2, v3, v4, v5, v6, v7, v8, v9,
+    v10, v11, v12, v13, v14, v15, v16, v17, v18, v19,
+    END
+  };
+  ENUM_STRINGS(Large,
+               "zero", "one", "two", "three", "four", "five", "six", "seven", "eight", "nine",
+               "fifteen_chars..", "sixteen_chars...", "a_name_well_outside_of_any_small_string_buffer",
+               "thirteen", "fourteen", "fifteen", "sixteen", "seventeen", "eighteen",
+               "a_name_of_exactly_twenty_three");
+}
+
+/// Stream buffer over a fixed array, so that the streams themselves never allocate
+class array_buf : public std::streambuf
+{
+public:
+
+  array_buf() { reset(); }
+
+  void reset()
+  {
+    setp(m_data, m_data + sizeof(m_data));
+    setg(m_data, m_data, m_data);
+  }
+
+  void flip(char const terminator)
+  {
+    *pptr() = terminator;
+    setg(m_data, m_data, pptr() + 1);
+  }
+
+private:
+
+  char m_data[256];
+};
+
+template <typename E>
+void test_allocations(E const e)
+{
+  // Names that do not fit in the small string buffer need exactly one allocation for the result
+  std::size_t const sso_capacity = std::string().capacity();
+  std::size_t const length = enum_strings::to_string_view(e).size();
+  std::size_t const expected = length > sso_capacity ? 1 : 0;
+
+  assert(count_allocations([&] { enum_strings::to_string(e); }) == expected);
+
+  std::string const s = enum_strings::to_string(e);
+  E v{};
+  assert(count_allocations([&] { v = enum_strings::from_string<E>(s); }) == 0 && v == e);
+  assert(count_allocations([&] { v = enum_strings::from_string<E>(s.c_str()); }) == 0 && v == e);
+  assert(count_allocations([&] { v = enum_strings::from_string<E>(s.data(), s.size()); }) == 0 && v == e);
+  assert(count_allocations([&] { enum_strings::try_from_string(s, v); }) == 0);
+  assert(count_allocations([&] { enum_strings::to_string_view(e); }) == 0);
+
+  array_buf buf;
+  std::ostream os(&buf);
+  std::istream is(&buf);
+  assert(count_allocations([&] { os << e; }) == 0);
+  buf.flip(' ');
+  assert(count_allocations([&] { is >> v; }) == expected && v == e);
+}
+
+template <typename E>
+void test_get_strings_allocations()
+{
+  // One for the vector and one for each name outside the small string buffer
+  std::size_t const sso_capacity = std::string().capacity();
+  std::size_t expected = 1;
+  for (std::size_t i = 0; i < enum_strings::num_values<E>(); ++i)
+  {
+    expected += enum_strings::to_string_view(static_cast<E>(i)).size() > sso_capacity ? 1 : 0;
+  }
+  assert(count_allocations([] { enum_strings::get_strings<E>(); }) == expected);
+}
+
+template <typename E>
+void test_error_allocations()
+{
+  // The only allocation on failure is the message copied into the exception object:
+  // one with libstdc++ and libc++, none where the standard library copies it with malloc
+  std::size_t const message = count_allocations([] { std::invalid_argument const e("message"); });
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)
+  assert(message == 1);
+#endif
+  std::size_t const n = count_allocations([]
+  {
+    try
+    {
+      enum_strings::from_string<E>("not a name");
+      assert(false);
+    }
+    catch (std::invalid_argument const &) {}
+  });
+  assert(n == message);
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Small;
+  using N1::Large;
+
+  for (std::size_t i = 0; i < enum_strings::num_values<Small>(); ++i)
+  {
+    test_allocations(static_cast<Small>(i));
+  }
+  for (std::size_t i = 0; i < enum_strings::num_values<Large>(); ++i)
+  {
+    test_allocations(static_cast<Large>(i));
+  }
+
+  test_get_strings_allocations<Small>();
+  test_get_strings_allocations<Large>();
+
+  test_error_allocations<Small>();
+  test_error_allocations<Large>();
+
+  return 0;
+}
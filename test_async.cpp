@@ -0,0 +1,176 @@
+#include "enum_strings_async.h"
+
+#include <cassert>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace N1
+{
+  enum class State { Idle, Running, Stalled, END };
+  ENUM_STRINGS(State, "Idle", "Running", "Stalled");
+}
+
+using N1::State;
+
+enum_strings::async::detached_task consume(enum_strings::async::event_loop & loop,
+                                           int const fd,
+                                           std::vector<State> & out,
+                                           bool & failed)
+{
+  auto gen = enum_strings::async::parse_enum_stream<State>(loop, fd);
+  try
+  {
+    while (auto const e = co_await gen.next())
+    {
+      out.push_back(*e);
+    }
+  }
+  catch (std::invalid_argument const &)
+  {
+    failed = true;
+  }
+}
+
+/// A coroutine that starts immediately and is destroyed with its owner, even while suspended
+struct owned_task
+{
+  struct promise_type
+  {
+    owned_task get_return_object() { return owned_task{ std::coroutine_handle<promise_type>::from_promise(*this) }; }
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+    std::suspend_always final_suspend() const noexcept { return {}; }
+    void return_void() const noexcept {}
+    void unhandled_exception() const noexcept { std::terminate(); }
+  };
+
+  explicit owned_task(std::coroutine_handle<promise_type> const h) : handle(h) {}
+  owned_task(owned_task const &) = delete;
+  ~owned_task() { handle.destroy(); }
+
+  std::coroutine_handle<promise_type> handle;
+};
+
+owned_task consume_one(enum_strings::async::async_generator<State> & gen, std::vector<State> & out)
+{
+  while (auto const e = co_await gen.next())
+  {
+    out.push_back(*e);
+  }
+}
+
+void write_all(int const fd, std::string const & s)
+{
+  ssize_t const n = ::write(fd, s.data(), s.size());
+  assert(n == static_cast<ssize_t>(s.size()));
+}
+
+///////////////////////////////
+
+int main()
+{
+  enum_strings::async::event_loop loop;
+
+  // many inputs on one loop, with tokens split across writes
+  std::size_t const num_inputs = 200;
+  std::string const text = "Idle Running\nStalled  Running\tIdle";
+  std::vector<State> const expected{ State::Idle, State::Running, State::Stalled, State::Running, State::Idle };
+
+  struct input
+  {
+    int read_fd;
+    int write_fd;
+    std::vector<State> values;
+    bool failed = false;
+  };
+  std::vector<input> inputs(num_inputs);
+  for (auto & in : inputs)
+  {
+    int fds[2];
+    int const rc = ::pipe(fds);
+    assert(rc == 0);
+    in.read_fd = fds[0];
+    in.write_fd = fds[1];
+    consume(loop, in.read_fd, in.values, in.failed);
+  }
+  assert(loop.waiting() == num_inputs);
+
+  std::size_t const split = 7; // in the middle of "Running"
+  for (std::size_t i = 0; i < num_inputs; ++i)
+  {
+    write_all(inputs[i].write_fd, text.substr(0, split + i % 3));
+  }
+  while (loop.run_once(0) > 0);
+  for (std::size_t i = 0; i < num_inputs; ++i)
+  {
+    assert(inputs[i].values == std::vector<State>{ State::Idle });
+    write_all(inputs[i].write_fd, text.substr(split + i % 3));
+    ::close(inputs[i].write_fd);
+  }
+  loop.run();
+
+  for (auto const & in : inputs)
+  {
+    assert(in.values == expected);
+    assert(!in.failed);
+    ::close(in.read_fd);
+  }
+
+  // invalid token
+  {
+    int fds[2];
+    int const rc = ::pipe(fds);
+    assert(rc == 0);
+    std::vector<State> out;
+    bool bad = false;
+    consume(loop, fds[0], out, bad);
+    write_all(fds[1], "Idle Runnin Idle");
+    ::close(fds[1]);
+    loop.run();
+    assert(bad);
+    assert(out == std::vector<State>{ State::Idle });
+    ::close(fds[0]);
+  }
+
+  // destroying generators suspended on I/O cancels their waits
+  {
+    int fds[2];
+    int rc = ::pipe(fds);
+    assert(rc == 0);
+    int other[2];
+    rc = ::pipe(other);
+    assert(rc == 0);
+
+    std::vector<State> out;
+    std::optional<enum_strings::async::async_generator<State>> gen(enum_strings::async::parse_enum_stream<State>(loop, fds[0]));
+    std::vector<State> other_out;
+    bool other_failed = false;
+    consume(loop, other[0], other_out, other_failed);
+    {
+      owned_task const task = consume_one(*gen, out);
+      assert(loop.waiting() == 2);
+
+      write_all(fds[1], "Idle Runn");
+      assert(loop.run_once(0) == 1);
+      assert(out == std::vector<State>{ State::Idle });
+      assert(loop.waiting() == 2);
+    }
+    gen.reset();
+    assert(loop.waiting() == 1);
+
+    // no event is delivered to the destroyed frame, and run() returns once the other input ends
+    write_all(fds[1], "ing Idle ");
+    write_all(other[1], "Stalled");
+    ::close(other[1]);
+    loop.run();
+    assert(loop.waiting() == 0);
+    assert(other_out == std::vector<State>{ State::Stalled });
+    assert(loop.run_once(0) == 0);
+
+    ::close(fds[1]);
+    ::close(fds[0]);
+    ::close(other[0]);
+  }
+
+  return 0;
+}
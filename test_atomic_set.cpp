@@ -0,0 +1,127 @@
+#include "enum_strings_atomic_set.h"
+
+#include <cassert>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace N1
+{
+  enum class Capability { read, write, execute, END };
+  ENUM_STRINGS(Capability, "read", "write", "execute");
+
+  // Spans two words
+  enum class Flag
+  {
+    f0, f1, f2, f3, f4, f5, f6, f7, f8, f9,
+    f10, f11, f12, f13, f14, f15, f16, f17, f18, f19,
+    f20, f21, f22, f23, f24, f25, f26, f27, f28, f29,
+    f30, f31, f32, f33, f34, f35, f36, f37, f38, f39,
+    f40, f41, f42, f43, f44, f45, f46, f47, f48, f49,
+    f50, f51, f52, f53, f54, f55, f56, f57, f58, f59,
+    f60, f61, f62, f63, f64, f65, f66, f67, f68, f69,
+    END
+  };
+  ENUM_STRINGS(Flag,
+               "f0", "f1", "f2", "f3", "f4", "f5", "f6", "f7", "f8", "f9",
+               "f10", "f11", "f12", "f13", "f14", "f15", "f16", "f17", "f18", "f19",
+               "f20", "f21", "f22", "f23", "f24", "f25", "f26", "f27", "f28", "f29",
+               "f30", "f31", "f32", "f33", "f34", "f35", "f36", "f37", "f38", "f39",
+               "f40", "f41", "f42", "f43", "f44", "f45", "f46", "f47", "f48", "f49",
+               "f50", "f51", "f52", "f53", "f54", "f55", "f56", "f57", "f58", "f59",
+               "f60", "f61", "f62", "f63", "f64", "f65", "f66", "f67", "f68", "f69");
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Capability;
+  using N1::Flag;
+
+  static_assert(enum_strings::atomic_enum_set<Capability>::num_words == 1, "");
+  static_assert(enum_strings::atomic_enum_set<Flag>::num_words == 2, "");
+  static_assert(alignof(enum_strings::atomic_enum_set<Flag>) == enum_strings::atomic_enum_set<Flag>::cache_line, "");
+  static_assert(sizeof(enum_strings::atomic_enum_set<Flag>) == 2 * enum_strings::atomic_enum_set<Flag>::cache_line, "");
+
+  // single-threaded semantics
+  {
+    enum_strings::atomic_enum_set<Capability> caps;
+    assert(caps.snapshot().empty());
+    bool const inserted_write = caps.insert(Capability::write);
+    assert(inserted_write);
+    bool const inserted_write_again = caps.insert(Capability::write);
+    assert(!inserted_write_again);
+    assert(caps.contains(Capability::write) && !caps.contains(Capability::read));
+    bool const inserted_execute = caps.insert(Capability::execute, std::memory_order_release);
+    assert(inserted_execute);
+    assert((caps.snapshot() == enum_strings::enum_set<Capability>{ Capability::write, Capability::execute }));
+
+    std::ostringstream os;
+    os << caps;
+    assert(os.str() == "write|execute");
+
+    bool const erased_write = caps.erase(Capability::write);
+    assert(erased_write);
+    bool const erased_write_again = caps.erase(Capability::write);
+    assert(!erased_write_again);
+    bool const erased_read = caps.erase(Capability::read);
+    assert(!erased_read);
+    assert(!caps.contains(Capability::write, std::memory_order_acquire));
+    caps.clear();
+    assert(caps.snapshot().empty());
+
+    std::ostringstream empty;
+    empty << caps;
+    assert(empty.str().empty());
+
+    enum_strings::atomic_enum_set<Capability> const copy(enum_strings::enum_set<Capability>{ Capability::read });
+    assert(copy.contains(Capability::read) && copy.snapshot().size() == 1);
+  }
+
+  // concurrent updates of bits sharing words are not lost
+  {
+    enum_strings::atomic_enum_set<Flag> flags;
+    std::size_t const n = enum_strings::num_values<Flag>();
+    unsigned const threads = 4;
+    std::vector<unsigned> inserted(threads, 0);
+    std::vector<unsigned> erased(threads, 0);
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t)
+    {
+      pool.emplace_back([&, t]
+      {
+        for (int round = 0; round < 1000; ++round)
+        {
+          for (std::size_t i = t; i < n; i += threads)
+          {
+            inserted[t] += flags.insert(static_cast<Flag>(i)) ? 1 : 0;
+            if (round + 1 < 1000)
+            {
+              erased[t] += flags.erase(static_cast<Flag>(i)) ? 1 : 0;
+            }
+          }
+        }
+      });
+    }
+    for (auto & thread : pool)
+    {
+      thread.join();
+    }
+    for (unsigned t = 0; t < threads; ++t)
+    {
+      assert(inserted[t] == 1000 * ((n - t + threads - 1) / threads));
+      assert(erased[t] == 999 * ((n - t + threads - 1) / threads));
+    }
+    enum_strings::enum_set<Flag> const all = flags.snapshot();
+    assert(all.size() == n);
+    assert(flags.contains(Flag::f0) && flags.contains(Flag::f69));
+
+    std::ostringstream os;
+    os << flags;
+    assert(os.str().compare(0, 9, "f0|f1|f2|") == 0);
+    assert(os.str().size() == 10 * 2 + 60 * 3 + 69);
+  }
+
+  return 0;
+}
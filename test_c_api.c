@@ -0,0 +1,62 @@
+#include "enum_strings_c.h"
+
+#include <assert.h>
+#include <string.h>
+
+/* Exported by a shared library built with hidden symbols by default */
+ENUM_STRINGS_DECLARE_C(test_level);
+ENUM_STRINGS_DECLARE_C(test_shape);
+
+/* ============================= */
+
+int main(void)
+{
+  enum_strings_descriptor const * const level = test_level_descriptor();
+  enum_strings_descriptor const * const shape = test_shape_descriptor();
+
+  assert(level == test_level_descriptor());
+  assert(strcmp(level->type_name, "Level") == 0);
+  assert(level->count == 3 && shape->count == 2);
+  assert(strcmp(level->names[2], "a rather long name") == 0 && level->lengths[2] == 18);
+  assert(level->fingerprint != shape->fingerprint);
+
+  /* codes -> names */
+  {
+    int32_t const codes[4] = { 1, 2, 0, 1 };
+    char buf[64];
+    size_t offsets[5];
+    assert(enum_strings_decode(level, codes, 4, buf, sizeof(buf), offsets) == 4);
+    assert(offsets[4] == 29 && memcmp(buf, "infoa rather long namedbginfo", 29) == 0);
+    assert(offsets[1] == 4 && offsets[2] == 22 && offsets[3] == 25);
+
+    /* the exported functions directly */
+    size_t direct[5];
+    assert(test_level_decode(codes, 4, buf, sizeof(buf), direct) == 4);
+    assert(memcmp(direct, offsets, sizeof(direct)) == 0);
+
+    /* stops at the first name that does not fit */
+    assert(enum_strings_decode(level, codes, 4, buf, 20, offsets) == 1);
+    assert(offsets[1] == 4);
+    assert(enum_strings_decode(level, codes, 0, buf, 0, offsets) == 0 && offsets[0] == 0);
+  }
+
+  /* names -> codes, and invalid input */
+  {
+    char const chars[] = "squarecirclesquarecircl";
+    size_t const offsets[5] = { 0, 6, 12, 18, 23 };
+    int32_t codes[4] = { -1, -1, -1, -1 };
+    assert(enum_strings_encode(shape, chars, offsets, 3, codes) == 3);
+    assert(codes[0] == 1 && codes[1] == 0 && codes[2] == 1);
+    assert(enum_strings_encode(shape, chars, offsets, 4, codes) == 3);
+    assert(test_shape_encode(chars + 6, offsets, 1, codes) == 1 && codes[0] == 0);
+
+    int32_t const bad[3] = { 0, 3, 1 };
+    char buf[64];
+    size_t out_offsets[4];
+    assert(enum_strings_decode(level, bad, 3, buf, sizeof(buf), out_offsets) == 1);
+    int32_t const negative[1] = { -1 };
+    assert(enum_strings_decode(level, negative, 1, buf, sizeof(buf), out_offsets) == 0);
+  }
+
+  return 0;
+}
@@ -0,0 +1,13 @@
+#include "enum_strings_c.h"
+
+namespace N1
+{
+  enum class Level : std::uint8_t { Debug, Info, Critical, END };
+  ENUM_STRINGS(Level, "dbg", "info", "a rather long name");
+
+  enum Shape { Circle, Square, END };
+  ENUM_STRINGS(Shape, "circle", "square");
+}
+
+ENUM_STRINGS_EXPORT_C(N1::Level, test_level)
+ENUM_STRINGS_EXPORT_C(N1::Shape, test_shape)
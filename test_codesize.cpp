@@ -0,0 +1,75 @@
+// Reference call sites of the public API. This file is only compiled, never run:
+// cmake/CheckCodeSize.cmake measures each function below in the object file and
+// compares it against test_codesize.budget, so that changes that bloat every call
+// site or stop the conversions from being inlined fail like any other test.
+
+#include "enum_strings.h"
+
+#include <istream>
+#include <ostream>
+
+namespace N1
+{
+  enum class Mode { fast, safe, debug, END };
+  ENUM_STRINGS(Mode, "fast", "safe", "debug");
+}
+
+using N1::Mode;
+
+extern "C"
+{
+
+bool codesize_to_string_view(Mode const m, char const ** const data, std::size_t * const size)
+{
+  enum_strings::name_view const v = enum_strings::to_string_view(m);
+  *data = v.data();
+  *size = v.size();
+  return !v.empty();
+}
+
+bool codesize_try_from_string(char const * const s, std::size_t const n, Mode * const m)
+{
+  return enum_strings::try_from_string(s, n, *m);
+}
+
+bool codesize_is_valid_code(int const code)
+{
+  return enum_strings::is_valid_code<Mode>(code);
+}
+
+std::size_t codesize_validate_codes(int const * const codes, std::size_t const n)
+{
+  return enum_strings::validate_codes<Mode>(codes, n);
+}
+
+void codesize_to_string(Mode const m, std::string * const out)
+{
+  *out = enum_strings::to_string(m);
+}
+
+Mode codesize_from_string(std::string const * const s)
+{
+  return enum_strings::from_string<Mode>(*s);
+}
+
+void codesize_get_strings(std::vector<std::string> * const out)
+{
+  *out = enum_strings::get_strings<Mode>();
+}
+
+void codesize_write(std::ostream * const os, Mode const m)
+{
+  *os << m;
+}
+
+void codesize_read(std::istream * const is, Mode * const m)
+{
+  *is >> *m;
+}
+
+void codesize_name_buffer(Mode const m, enum_strings::enum_name_buffer<Mode> * const out)
+{
+  out->assign(m);
+}
+
+} // extern "C"
@@ -0,0 +1,113 @@
+#include "enum_strings_config.h"
+
+#include <cassert>
+#include <cstdio>
+
+namespace N1
+{
+  enum class Mode { fast, safe, debug, END };
+  ENUM_STRINGS(Mode, "fast", "safe", "debug");
+
+  enum class Option { threads, cache_size, mode, verbose, ratio, name, offset, END };
+  ENUM_STRINGS(Option, "threads", "cache_size", "mode", "verbose", "ratio", "name", "offset");
+
+  using Config = enum_strings::enum_config<Option, unsigned, std::size_t, Mode, bool, double, std::string, std::int8_t>;
+}
+
+template <typename C>
+void test_error(std::string const & text, std::size_t const line, std::size_t const column)
+{
+  C config;
+  bool thrown = false;
+  try
+  {
+    config.parse(text.data(), text.size());
+  }
+  catch (enum_strings::config_error const & e)
+  {
+    thrown = true;
+    assert(e.line() == line);
+    assert(e.column() == column);
+  }
+  assert(thrown);
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Option;
+  using N1::Mode;
+  using N1::Config;
+
+  std::string const text =
+    "# comment\n"
+    "threads = 8\n"
+    "\n"
+    "  cache_size=1048576  \r\n"
+    "mode = safe\n"
+    "verbose\t= true\n"
+    "ratio = 0.25\n"
+    "name = hello world\n"
+    "offset = -128\n"
+    "threads = 16";
+
+  {
+    Config config;
+    config.set<Option::mode>(Mode::debug);
+    config.parse(text.data(), text.size());
+    assert(config.get<Option::threads>() == 16);
+    assert(config.get<Option::cache_size>() == 1048576);
+    assert(config.get<Option::mode>() == Mode::safe);
+    assert(config.get<Option::verbose>() == true);
+    assert(config.get<Option::ratio>() == 0.25);
+    assert(config.get<Option::name>() == "hello world");
+    assert(config.get<Option::offset>() == -128);
+    assert(config.keys().size() == 7);
+  }
+
+  {
+    Config config;
+    std::string const partial = "mode = fast\n";
+    config.parse(partial.data(), partial.size());
+    assert(config.contains(Option::mode) && !config.contains(Option::threads));
+    assert(config.get<Option::threads>() == 0);
+  }
+
+  test_error<Config>("threads = 1\nbogus = 2\n", 2, 1);
+  test_error<Config>("threads 1\n", 1, 9);
+  test_error<Config>("threads = -1\n", 1, 11);
+  test_error<Config>("threads = 99999999999\n", 1, 11);
+  test_error<Config>("offset = 128\n", 1, 10);
+  test_error<Config>("mode = turbo\n", 1, 8);
+  test_error<Config>("verbose = yes\n", 1, 11);
+  test_error<Config>("ratio = 1.5x\n", 1, 9);
+
+  {
+    char path[] = "/tmp/enum_strings_config_XXXXXX";
+    int const fd = ::mkstemp(path);
+    assert(fd >= 0);
+    ssize_t const n = ::write(fd, text.data(), text.size());
+    assert(n == static_cast<ssize_t>(text.size()));
+    ::close(fd);
+
+    Config config;
+    config.load(path);
+    assert(config.get<Option::threads>() == 16);
+    assert(config.get<Option::name>() == "hello world");
+    ::unlink(path);
+
+    bool thrown = false;
+    try
+    {
+      config.load(path);
+    }
+    catch (std::system_error const &)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+  }
+
+  return 0;
+}
@@ -0,0 +1,61 @@
+#include "enum_strings_core.h"
+
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+
+namespace N1
+{
+  enum class Mode { fast, safe, debug, END };
+  ENUM_STRINGS(Mode, "fast", "safe", "debug");
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Mode;
+
+  static_assert(enum_strings::num_values<Mode>() == 3, "");
+  static_assert(enum_strings::to_string_view(Mode::safe) == enum_strings::name_view("safe", 4), "");
+  static_assert(enum_strings::to_string_view(Mode::debug).size() == 5, "");
+  static_assert(enum_strings::to_string_view(static_cast<Mode>(3)).empty(), "");
+  static_assert(enum_strings::to_string_view(static_cast<Mode>(-1)) != enum_strings::name_view("fast", 4), "");
+
+  constexpr auto help = enum_strings::joined_names<Mode>("|");
+  static_assert(help.size() == 15 && help.view() == enum_strings::name_view("fast|safe|debug", 15), "");
+  static_assert(enum_strings::joined_names<Mode>(", ").size() == 17, "");
+  static_assert(enum_strings::joined_names<Mode>("").view() == enum_strings::name_view("fastsafedebug", 13), "");
+  assert(help.c_str()[15] == '\0');
+
+  assert(enum_strings::to_string_view(Mode::fast).data()[4] == '\0');
+
+  static_assert(enum_strings::max_name_length<Mode>() == 5 && enum_strings::min_name_length<Mode>() == 4, "");
+
+  using buffer = enum_strings::enum_name_buffer<Mode>;
+  static_assert(std::is_trivially_copyable<buffer>::value && sizeof(buffer) == 6, "");
+  static_assert(buffer(Mode::debug).view() == enum_strings::name_view("debug", 5), "");
+  static_assert(buffer(static_cast<Mode>(3)).empty() && buffer() == buffer(static_cast<Mode>(3)), "");
+
+  buffer record[2];
+  buffer const safe(Mode::safe);
+  std::memcpy(&record[1], &safe, sizeof(buffer));
+  Mode r = Mode::fast;
+  assert(record[1].to_enum(r) && r == Mode::safe);
+  assert(!record[0].to_enum(r) && r == Mode::safe);
+  record[0].assign(Mode::debug);
+  assert(record[0] != record[1] && record[0].to_enum(r) && r == Mode::debug);
+
+  Mode m = Mode::fast;
+  assert(enum_strings::try_from_string("debug", 5, m) && m == Mode::debug);
+  assert(!enum_strings::try_from_string("debugger", 8, m) && m == Mode::debug);
+
+  std::size_t length = 0;
+  for (char const c : enum_strings::to_string_view(Mode::safe))
+  {
+    assert(c == "safe"[length++]);
+  }
+  assert(length == 4);
+
+  return 0;
+}
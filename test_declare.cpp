@@ -0,0 +1,43 @@
+#include "test_declare.h"
+
+#include <cassert>
+#include <sstream>
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Color;
+  using N1::Foo;
+
+  assert(enum_strings::num_values<Color>() == 3);
+  assert(enum_strings::to_string(Color::blue) == "dark blue");
+  assert(enum_strings::from_string<Color>("green") == Color::green);
+  assert(enum_strings::to_string(Foo::B) == "nb");
+  assert(enum_strings::from_string<Foo::NestedEnum>("na") == Foo::A);
+  assert(std::string(enum_strings::type_name<Foo::NestedEnum>()) == "Foo::NestedEnum");
+  assert(enum_strings::get_strings<Color>() == (std::vector<std::string>{ "red", "green", "dark blue" }));
+
+  Color c = Color::red;
+  assert(!enum_strings::try_from_string("blue", 4, c));
+  assert(c == Color::red);
+
+  std::stringstream ss;
+  ss << Color::green << ' ' << Foo::A;
+  Foo::NestedEnum f;
+  ss >> c >> f;
+  assert(c == Color::green && f == Foo::A);
+
+  bool thrown = false;
+  try
+  {
+    enum_strings::to_string(static_cast<Color>(3));
+  }
+  catch (std::invalid_argument const &)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+
+  return 0;
+}
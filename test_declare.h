@@ -0,0 +1,20 @@
+#ifndef ENUM_STRINGS_TEST_DECLARE_H
+#define ENUM_STRINGS_TEST_DECLARE_H
+
+#include "enum_strings.h"
+
+#include <iosfwd>
+
+namespace N1
+{
+  enum class Color { red, green, blue, END };
+  ENUM_STRINGS_DECLARE(Color);
+
+  struct Foo
+  {
+    enum NestedEnum { A, B };
+  };
+  ENUM_STRINGS_DECLARE(Foo::NestedEnum);
+}
+
+#endif //ENUM_STRINGS_TEST_DECLARE_H
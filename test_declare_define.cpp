@@ -0,0 +1,9 @@
+#include "test_declare.h"
+
+#include <iostream>
+
+namespace N1
+{
+  ENUM_STRINGS_DEFINE(Color, "red", "green", "dark blue");
+  ENUM_STRINGS_DEFINE(Foo::NestedEnum, "na", "nb");
+}
@@ -0,0 +1,141 @@
+#include "enum_strings_filter.h"
+
+#include <cassert>
+#include <vector>
+
+template <typename E, typename T>
+void test_select(enum_strings::enum_filter<E> const & filter, std::vector<T> const & codes)
+{
+  std::size_t const n = codes.size();
+
+  std::vector<std::uint64_t> bitmap(enum_strings::bitmap_words(n), ~std::uint64_t{0});
+  filter.select(codes.data(), n, bitmap.data());
+
+  std::vector<std::size_t> indices(n);
+  indices.resize(filter.select_indices(codes.data(), n, indices.data()));
+
+  std::vector<std::size_t> expected;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    std::size_t const c = enum_strings::detail::code_index(codes[i]);
+    bool const selected = c < enum_strings::num_values<E>() && filter.values().contains(static_cast<E>(c));
+    assert(((bitmap[i / 64] >> (i % 64)) & 1) == selected);
+    if (selected)
+    {
+      expected.push_back(i);
+    }
+  }
+  assert(n % 64 == 0 || (bitmap.back() >> (n % 64)) == 0);
+  assert(indices == expected);
+
+  for (unsigned bits : { 4u, 7u, 8u, 13u })
+  {
+    std::vector<std::uint64_t> packed(enum_strings::packed_words(n, bits));
+    std::vector<std::uint16_t> masked(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      masked[i] = static_cast<std::uint16_t>(enum_strings::detail::code_index(codes[i]) & ((1u << bits) - 1));
+    }
+    enum_strings::pack_codes(masked.data(), n, bits, packed.data());
+
+    std::vector<std::uint64_t> expected_bitmap(bitmap.size());
+    filter.select(masked.data(), n, expected_bitmap.data());
+    std::vector<std::uint64_t> packed_bitmap(bitmap.size());
+    filter.select_packed(packed.data(), n, bits, packed_bitmap.data());
+    assert(packed_bitmap == expected_bitmap);
+
+    std::vector<std::uint32_t> packed_indices(n);
+    packed_indices.resize(filter.select_packed_indices(packed.data(), n, bits, packed_indices.data()));
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      if ((expected_bitmap[i / 64] >> (i % 64)) & 1)
+      {
+        assert(k < packed_indices.size() && packed_indices[k++] == i);
+      }
+    }
+    assert(k == packed_indices.size());
+  }
+}
+
+template <typename T>
+std::vector<T> make_codes(std::size_t const n, unsigned const range)
+{
+  std::vector<T> codes(n);
+  unsigned x = 12345;
+  for (auto & c : codes)
+  {
+    x = x * 1103515245u + 12345u;
+    c = static_cast<T>((x >> 16) % range);
+  }
+  return codes;
+}
+
+///////////////////////////////
+
+namespace N1
+{
+  enum class Status : std::uint8_t { ok, failed, timeout, retry, cancelled, END };
+  ENUM_STRINGS(Status, "ok", "failed", "timeout", "retry", "cancelled");
+}
+
+namespace N2
+{
+  enum class Wide : int { A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P, Q, R, S, T, END };
+  ENUM_STRINGS(Wide, "a", "b", "c", "d", "e", "f", "g", "h", "i", "j",
+                     "k", "l", "m", "n", "o", "p", "q", "r", "s", "t");
+}
+
+///////////////////////////////
+
+int main()
+{
+  {
+    enum_strings::enum_set<N2::Wide> set{ N2::Wide::A, N2::Wide::T };
+    assert(set.size() == 2 && set.contains(N2::Wide::T) && !set.contains(N2::Wide::B));
+    set.insert(N2::Wide::B);
+    set.erase(N2::Wide::A);
+    std::vector<N2::Wide> values;
+    set.for_each([&](N2::Wide const e) { values.push_back(e); });
+    assert((values == std::vector<N2::Wide>{ N2::Wide::B, N2::Wide::T }));
+    set.clear();
+    assert(set.empty());
+  }
+  {
+    enum_strings::enum_filter<N1::Status> const filter{ "failed", "timeout" };
+    assert(filter.values() == (enum_strings::enum_set<N1::Status>{ N1::Status::failed, N1::Status::timeout }));
+
+    for (std::size_t n : { 0, 1, 63, 64, 65, 1000 })
+    {
+      test_select(filter, make_codes<N1::Status>(n, 5));
+      test_select(filter, make_codes<std::uint8_t>(n, 256));
+      test_select(filter, make_codes<std::int8_t>(n, 256));
+      test_select(filter, make_codes<std::uint32_t>(n, 8));
+    }
+  }
+  {
+    enum_strings::enum_filter<N2::Wide> const few{ "a", "q", "t" };
+    enum_strings::enum_filter<N2::Wide> const many{ "a", "b", "c", "d", "e", "f", "g", "h", "i", "j" };
+    for (std::size_t n : { 0, 1, 64, 1000 })
+    {
+      test_select(few, make_codes<std::uint8_t>(n, 24));
+      test_select(few, make_codes<std::int8_t>(n, 256));
+      test_select(many, make_codes<std::uint8_t>(n, 24));
+      test_select(many, make_codes<N2::Wide>(n, 20));
+    }
+  }
+  {
+    bool thrown = false;
+    try
+    {
+      enum_strings::enum_filter<N1::Status> const filter{ "failed", "bogus" };
+    }
+    catch (std::invalid_argument const &)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+  }
+
+  return 0;
+}
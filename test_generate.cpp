@@ -0,0 +1,81 @@
+#include "test_generate.h"
+#include "test_generate_front_coded.h"
+#include "test_generate_keywords.h"
+
+#include <cassert>
+#include <cstring>
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Color;
+
+  static_assert(enum_strings::num_values<Color>() == 5, "");
+  static_assert(static_cast<int>(Color::yellow) == 2, "");
+  static_assert(static_cast<int>(Color::dark_blue) == 3, "");
+
+  assert(enum_strings::to_string(Color::red) == "red");
+  assert(enum_strings::to_string(Color::dark_blue) == "dark blue");
+  assert(enum_strings::to_string(Color::a_b_c_d) == "a,b?c\\\\d");
+
+  for (std::string const & name : enum_strings::get_strings<Color>())
+  {
+    assert(enum_strings::to_string(enum_strings::from_string<Color>(name)) == name);
+  }
+
+  // aliases are accepted, but not produced
+  assert(enum_strings::from_string<Color>("r") == Color::red);
+  assert(enum_strings::from_string<Color>("navy") == Color::dark_blue);
+  assert(enum_strings::from_string<Color>("\"blue\"") == Color::dark_blue);
+
+  Color c = Color::green;
+  assert(!enum_strings::try_from_string("", 0, c));
+  assert(!enum_strings::try_from_string("blue", 4, c));
+  assert(!enum_strings::try_from_string("redd", 4, c));
+  assert(!enum_strings::try_from_string("re", 2, c));
+  assert(c == Color::green);
+
+  // the generated lookup reports its size to the registry: 8 names and aliases, with offsets, lengths and values
+  assert(enum_strings::detail::describe<Color>().index_bytes > 8 * 3 * sizeof(std::uint32_t));
+
+  // names that are keywords or reserved identifiers get usable enumerators
+  {
+    using N3::Keyword;
+    assert(enum_strings::to_string(Keyword::int_) == "int");
+    assert(enum_strings::to_string(Keyword::class_) == "class");
+    assert(enum_strings::to_string(Keyword::default_) == "default");
+    assert(enum_strings::to_string(Keyword::Reserved) == "_Reserved");
+    assert(enum_strings::to_string(Keyword::double_space) == "double  space");
+    assert(enum_strings::to_string(Keyword::co_await_) == "co_await");
+    assert(enum_strings::to_string(Keyword::_init_) == "__init__");
+    assert(enum_strings::from_string<Keyword>("class") == Keyword::class_);
+  }
+
+  // the same list stored front-coded, in blocks of two entries
+  namespace compressed = enum_strings::compressed;
+  using C2 = N2::Color;
+  assert(compressed::num_values<C2>() == 5);
+  assert(compressed::max_name_length<C2>() == 9);
+  for (std::size_t i = 0; i < compressed::num_values<C2>(); ++i)
+  {
+    std::string const name = compressed::to_string(static_cast<C2>(i));
+    assert(name == enum_strings::to_string(static_cast<Color>(i)));
+    assert(compressed::from_string<C2>(name) == static_cast<C2>(i));
+  }
+  char buf[9];
+  assert(compressed::to_string(C2::yellow, buf) == 6 && std::string(buf, 6) == "yellow");
+  assert(compressed::to_string(static_cast<C2>(5), buf) == 0);
+  assert(compressed::from_string<C2>("r") == C2::red);
+  assert(compressed::from_string<C2>("navy") == C2::dark_blue);
+  assert(compressed::from_string<C2>("\"blue\"") == C2::dark_blue);
+
+  C2 c2 = C2::green;
+  for (char const * const s : { "", "blue", "redd", "re", "a", "zzz", "dark blue!" })
+  {
+    assert(!compressed::try_from_string(s, std::strlen(s), c2));
+  }
+  assert(c2 == C2::green);
+
+  return 0;
+}
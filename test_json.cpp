@@ -0,0 +1,80 @@
+#include "enum_strings_json.h"
+
+#include <cassert>
+
+namespace N1
+{
+  enum class Kind { plain, quoted, path, control, unicode, END };
+  ENUM_STRINGS(Kind, "plain", "say \"hi\"", "a\\b/c", "tab\there\x01", "caf\xC3\xA9 \xF0\x9F\x98\x80");
+}
+
+template <typename E>
+void test_encode(E const e, std::string const & expected)
+{
+  char buf[64];
+  char * const end = enum_strings::to_json(e, buf);
+  assert(std::string(buf, end) == expected);
+  assert(enum_strings::json_length(e) == expected.size());
+  assert(expected.size() <= enum_strings::max_json_length<E>());
+
+  // round trip through the raw token contents
+  assert(enum_strings::from_json<E>(expected.data() + 1, expected.size() - 2) == e);
+}
+
+template <typename E>
+void test_decode(std::string const & raw, E const expected)
+{
+  E e{};
+  assert(enum_strings::try_from_json(raw.data(), raw.size(), e));
+  assert(e == expected);
+}
+
+template <typename E>
+void test_no_match(std::string const & raw)
+{
+  E e = static_cast<E>(0);
+  assert(!enum_strings::try_from_json(raw.data(), raw.size(), e));
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Kind;
+
+  test_encode(Kind::plain, "\"plain\"");
+  test_encode(Kind::quoted, "\"say \\\"hi\\\"\"");
+  test_encode(Kind::path, "\"a\\\\b/c\"");
+  test_encode(Kind::control, "\"tab\\there\\u0001\"");
+  test_encode(Kind::unicode, "\"caf\xC3\xA9 \xF0\x9F\x98\x80\"");
+
+  // equivalent escapes that the encoder does not produce
+  test_decode("pl\\u0061in", Kind::plain);
+  test_decode("a\\\\b\\/c", Kind::path);
+  test_decode("caf\\u00e9 \\ud83d\\ude00", Kind::unicode);
+  test_decode("caf\\u00E9 \xF0\x9F\x98\x80", Kind::unicode);
+
+  test_no_match<Kind>("");
+  test_no_match<Kind>("plai");
+  test_no_match<Kind>("plain\\");
+  test_no_match<Kind>("pl\\qain");
+  test_no_match<Kind>("pl\\u00");
+  test_no_match<Kind>("\\ud83d");
+  test_no_match<Kind>("\\ude00");
+  test_no_match<Kind>("plain plain plain plain plain plain \\n");
+
+  static_assert(enum_strings::max_json_length<Kind>() == 17, "max_json_length must be a constant expression");
+
+  bool thrown = false;
+  try
+  {
+    enum_strings::from_json<Kind>("bogus", 5);
+  }
+  catch (std::invalid_argument const &)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+
+  return 0;
+}
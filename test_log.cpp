@@ -0,0 +1,79 @@
+#include "enum_strings_log.h"
+
+#include <cassert>
+#include <sstream>
+
+namespace N1
+{
+  enum class Level { trace, debug, info, warning, error, END };
+  ENUM_STRINGS(Level, "trace", "debug", "info", "warning", "error");
+}
+
+namespace N2
+{
+  enum class Event { connect, disconnect, retry, END };
+  ENUM_STRINGS(Event, "connect", "dis connect", "retry");
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Level;
+  using N2::Event;
+  namespace log = enum_strings::log;
+
+  log::register_types<Level, Event>();
+  assert(log::type_index<Level>() == 0);
+  assert(log::type_index<Event>() == 1);
+
+  // the log header is written before any values
+  std::stringstream header;
+  log::write_schema(header);
+
+  char buf[4 * log::max_encoded_size];
+  char * p = buf;
+  char * const second = log::encode(Level::warning, p);
+  assert(second - p == 2);
+  p = log::encode(Event::disconnect, second);
+  p = log::encode_code(Level::error, p);
+  assert(p - buf == 5);
+
+  log::schema const schema(header);
+  assert(schema.size() == 2);
+  assert(schema.at(0).type_name == "Level");
+  assert(schema.at(0).fingerprint == enum_strings::fingerprint<Level>());
+  assert(schema.find(enum_strings::fingerprint<Event>()) == 1);
+  assert(schema.find(0) == schema.size());
+
+  char const * q = buf;
+  assert(schema.decode(q, p) == "warning");
+  assert(schema.decode(q, p) == "dis connect");
+  assert(schema.decode_code(0, q, p) == "error");
+  assert(q == p);
+
+  bool thrown = false;
+  try
+  {
+    schema.decode(q, p);
+  }
+  catch (std::out_of_range const &)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+
+  thrown = false;
+  try
+  {
+    std::istringstream bad("enum_strings schema 1\ntype 0 1 2 5 Level\n5 trace\n");
+    log::schema const truncated(bad);
+  }
+  catch (std::runtime_error const &)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+
+  return 0;
+}
@@ -0,0 +1,61 @@
+#include "enum_strings_matcher.h"
+
+#include <cassert>
+
+namespace N1
+{
+  enum class Mode { fast, faster, f, safe, debug, END };
+  ENUM_STRINGS(Mode, "fast", "faster", "f", "safe", "debug");
+}
+
+template <typename E>
+bool match_in_pieces(std::string const & s, std::size_t const split, E & e)
+{
+  enum_strings::enum_matcher<E> matcher;
+  matcher.reset();
+  matcher.feed(s.data(), split);
+  matcher.feed(s.data() + split, s.size() - split);
+  assert(matcher.size() <= s.size());
+  return matcher.match(e);
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Mode;
+
+  for (auto const & s : enum_strings::get_strings<Mode>())
+  {
+    for (std::size_t split = 0; split <= s.size(); ++split)
+    {
+      Mode e{};
+      bool const matched = match_in_pieces(s, split, e);
+      assert(matched && e == enum_strings::from_string<Mode>(s));
+    }
+  }
+
+  Mode e = Mode::safe;
+  bool const matched_prefix = match_in_pieces<Mode>("fas", 1, e);
+  assert(!matched_prefix && e == Mode::safe);
+  bool const matched_longer = match_in_pieces<Mode>("fastest", 3, e);
+  assert(!matched_longer && e == Mode::safe);
+  bool const matched_empty = match_in_pieces<Mode>("", 0, e);
+  assert(!matched_empty && e == Mode::safe);
+
+  enum_strings::enum_matcher<Mode> matcher;
+  matcher.reset();
+  bool const fed_f = matcher.feed('f');
+  bool const matched_f = matcher.match(e);
+  assert(fed_f && matched_f && e == Mode::f);
+  bool const fed_ast = matcher.feed("ast", 3);
+  bool const matched_fast = matcher.match(e);
+  assert(fed_ast && matched_fast && e == Mode::fast);
+  bool const fed_e = matcher.feed('e');
+  bool const matched_faste = matcher.match(e);
+  assert(fed_e && !matched_faste);
+  bool const fed_x = matcher.feed('x');
+  assert(!fed_x && !matcher.viable());
+
+  return 0;
+}
@@ -0,0 +1,44 @@
+#include "enum_strings_macros.h"
+
+#include <cassert>
+#include <sstream>
+#include <string>
+
+import enum_strings;
+
+namespace N1
+{
+  enum class Mode { fast, safe, debug, END };
+  ENUM_STRINGS(Mode, "fast", "safe", "debug");
+
+  enum class Level { low, high, END };
+  ENUM_STRINGS_DECLARE(Level);
+  ENUM_STRINGS_DEFINE(Level, "low", "high");
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Mode;
+
+  static_assert(enum_strings::num_values<Mode>() == 3);
+  static_assert(enum_strings::to_string_view(Mode::safe) == enum_strings::name_view("safe", 4));
+
+  assert(enum_strings::to_string(Mode::safe) == "safe");
+  assert(enum_strings::from_string<Mode>("debug") == Mode::debug);
+  assert(enum_strings::get_strings<Mode>().size() == 3);
+
+  std::stringstream ss;
+  ss << Mode::fast;
+  Mode m = Mode::debug;
+  ss >> m;
+  assert(m == Mode::fast);
+
+  using N1::Level;
+  assert(enum_strings::num_values<Level>() == 2);
+  assert(enum_strings::to_string(Level::high) == "high");
+  assert(enum_strings::from_string<Level>("low") == Level::low);
+
+  return 0;
+}
@@ -0,0 +1,121 @@
+#include "enum_strings_parallel.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace N1
+{
+  enum class Level { Debug, Info, Critical, END };
+  ENUM_STRINGS(Level, "dbg", "info", "a rather long name outside of the small string buffer");
+}
+
+template <typename E>
+std::vector<E> make_values(std::size_t const n)
+{
+  std::vector<E> values(n);
+  unsigned x = 1;
+  for (auto & v : values)
+  {
+    x = x * 1103515245u + 12345u;
+    v = static_cast<E>((x >> 16) % enum_strings::num_values<E>());
+  }
+  return values;
+}
+
+template <typename E>
+std::string expected_output(std::vector<E> const & values, std::string const & delimiter)
+{
+  std::string result;
+  for (E const e : values)
+  {
+    result += enum_strings::to_string(e) + delimiter;
+  }
+  return result;
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Level;
+
+  enum_strings::thread_pool pool(4);
+  assert(pool.size() == 4);
+
+  // sizes around the chunk boundaries
+  for (std::size_t const n : { std::size_t{ 0 }, std::size_t{ 1 }, std::size_t{ 16384 }, std::size_t{ 16385 }, std::size_t{ 100003 } })
+  {
+    std::vector<Level> const values = make_values<Level>(n);
+    std::string const text = enum_strings::parallel_to_strings(values.data(), n, ", ", pool);
+    assert(text == expected_output(values, ", "));
+    assert(enum_strings::parallel_to_strings(values.data(), n) == expected_output(values, "\n"));
+
+    std::vector<std::string> strings(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      strings[i] = enum_strings::to_string(values[i]);
+    }
+    std::vector<Level> out(n);
+    assert(enum_strings::parallel_from_strings(strings.data(), n, out.data(), pool) == n);
+    assert(out == values);
+
+    std::vector<enum_strings::name_view> views(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      views[i] = enum_strings::to_string_view(values[i]);
+    }
+    std::vector<Level> out2(n);
+    assert(enum_strings::parallel_from_strings(views.data(), n, out2.data()) == n);
+    assert(out2 == values);
+  }
+
+  // the first invalid position is reported, whichever thread finds it first
+  {
+    std::size_t const n = 100000;
+    std::vector<std::string> strings(n, "info");
+    strings[99999] = "bogus";
+    strings[20000] = "bogus";
+    strings[70000] = "bogus";
+    std::vector<Level> out(n, Level::Debug);
+    assert(enum_strings::parallel_from_strings(strings.data(), n, out.data(), pool) == 20000);
+    assert(out[0] == Level::Info && out[20000] == Level::Debug && out[99998] == Level::Info);
+
+    std::vector<Level> values = make_values<Level>(n);
+    values[90000] = static_cast<Level>(7);
+    values[30000] = static_cast<Level>(-1);
+    try
+    {
+      enum_strings::parallel_to_strings(values.data(), n, "\n", pool);
+      assert(false);
+    }
+    catch (std::invalid_argument const & e)
+    {
+      assert(std::string(e.what()).find("Invalid value -1.") == 0);
+    }
+  }
+
+  // exceptions thrown by tasks reach the caller, and the pool stays usable
+  {
+    try
+    {
+      pool.run(100, [](std::size_t const i) { if (i == 42) throw std::runtime_error("task 42"); });
+      assert(false);
+    }
+    catch (std::runtime_error const & e)
+    {
+      assert(std::string(e.what()) == "task 42");
+    }
+
+    std::vector<int> hits(1000, 0);
+    for (int round = 0; round < 200; ++round)
+    {
+      pool.run(hits.size(), [&](std::size_t const i) { ++hits[i]; });
+    }
+    for (int const h : hits)
+    {
+      assert(h == 200);
+    }
+  }
+
+  return 0;
+}
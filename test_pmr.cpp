@@ -0,0 +1,98 @@
+#include "enum_strings.h"
+
+#include <cassert>
+#include <memory_resource>
+
+namespace N1
+{
+  enum class Mode { fast, safe, a_rather_long_mode_name_that_does_not_fit_in_sso, END };
+  ENUM_STRINGS(Mode, "fast", "safe", "a rather long mode name that does not fit in SSO");
+}
+
+template <typename T>
+struct counting_allocator
+{
+  using value_type = T;
+
+  explicit counting_allocator(std::size_t * const count) noexcept : count(count) {}
+
+  template <typename U>
+  counting_allocator(counting_allocator<U> const & other) noexcept : count(other.count) {}
+
+  T * allocate(std::size_t const n)
+  {
+    ++*count;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T * const p, std::size_t const n) noexcept
+  {
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(counting_allocator<U> const & other) const noexcept { return count == other.count; }
+
+  template <typename U>
+  bool operator!=(counting_allocator<U> const & other) const noexcept { return count != other.count; }
+
+  std::size_t * count;
+};
+
+template <typename F>
+void test_error(F && f, std::string const & expected)
+{
+  bool thrown = false;
+  try
+  {
+    f();
+  }
+  catch (std::invalid_argument const & e)
+  {
+    thrown = true;
+    assert(e.what() == expected);
+  }
+  assert(thrown);
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Mode;
+
+  {
+    std::size_t count = 0;
+    counting_allocator<char> const alloc(&count);
+    auto const s = enum_strings::to_string(Mode::a_rather_long_mode_name_that_does_not_fit_in_sso, alloc);
+    assert(s == "a rather long mode name that does not fit in SSO");
+    assert(count == 1);
+
+    auto const v = enum_strings::get_strings<Mode>(alloc);
+    assert(v.size() == 3 && v[0] == "fast" && v[2] == s);
+    assert(count == 3);
+  }
+
+  {
+    // everything must come from the arena, which cannot grow
+    char buffer[1024];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    std::pmr::string const s = enum_strings::to_string(Mode::a_rather_long_mode_name_that_does_not_fit_in_sso, &arena);
+    assert(s.get_allocator().resource() == &arena);
+
+    std::pmr::vector<std::pmr::string> const v = enum_strings::get_strings<Mode>(&arena);
+    assert(v.size() == 3 && v[1] == "safe" && v[2] == s);
+    assert(v.get_allocator().resource() == &arena && v[2].get_allocator().resource() == &arena);
+  }
+
+  test_error([] { enum_strings::to_string(static_cast<Mode>(-7)); }, "Invalid value -7. Valid range is 0..2 (fast, safe, a rather long mode name that does not fit in SSO)");
+  test_error([] { enum_strings::from_string<Mode>("turbo"); }, "'turbo' is not a valid string representation of this type. "
+                                                                   "Valid values are: fast, safe, a rather long mode name that does not fit in SSO");
+  // overlong input is cut, and so is the whole message
+  std::string const full = "'" + std::string(128, 'x') + "...' is not a valid string representation of this type. "
+                           "Valid values are: fast, safe, a rather long mode name that does not fit in SSO";
+  test_error([] { enum_strings::from_string<Mode>(std::string(200, 'x')); }, full.substr(0, 252) + "...");
+
+  return 0;
+}
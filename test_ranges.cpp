@@ -0,0 +1,53 @@
+#include "enum_strings_ranges.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace N1
+{
+  enum class Status { ok, failed, timeout, END };
+  ENUM_STRINGS(Status, "ok", "failed", "timeout");
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Status;
+  namespace views = enum_strings::views;
+
+  // split line -> parse -> filter -> count, without temporary containers
+  std::string_view const line = "ok,failed,timeout,failed,ok";
+  auto parsed = line | std::views::split(',') | views::parse_enum<Status>;
+  assert(std::ranges::count(parsed, Status::failed) == 2);
+  assert(std::ranges::distance(parsed | std::views::filter([](Status const s) { return s != Status::ok; })) == 3);
+
+  // take a column of a table
+  std::string_view const rows[] = { "1 ok", "2 timeout", "3 failed" };
+  auto column = rows
+              | std::views::transform([](std::string_view const r) { return r.substr(r.find(' ') + 1); })
+              | views::parse_enum<Status>;
+  std::vector<Status> const expected{ Status::ok, Status::timeout, Status::failed };
+  assert(std::ranges::equal(column, expected));
+
+  // round trip through names
+  auto names = views::values<Status> | views::enum_names;
+  std::vector<std::string_view> const expected_names{ "ok", "failed", "timeout" };
+  assert(std::ranges::equal(names, expected_names));
+  assert(std::ranges::equal(names | views::parse_enum<Status>, views::values<Status>));
+  assert(std::ranges::size(views::values<Status>) == 3);
+
+  bool thrown = false;
+  try
+  {
+    std::string_view const bad = "ok,bogus";
+    std::ranges::count(bad | std::views::split(',') | views::parse_enum<Status>, Status::ok);
+  }
+  catch (std::invalid_argument const &)
+  {
+    thrown = true;
+  }
+  assert(thrown);
+
+  return 0;
+}
@@ -0,0 +1,132 @@
+#include "test_registry.h"
+#include "enum_strings_registry.h"
+
+#include <cassert>
+#include <cstring>
+#include <string>
+
+std::string other_shared_name();
+
+namespace N2
+{
+  enum class Local { alpha, beta };
+  ENUM_STRINGS(Local, "alpha", "beta");
+}
+
+namespace N3
+{
+  // Registered but never converted
+  enum class Unused { u };
+  ENUM_STRINGS(Unused, "u");
+}
+
+// Registration of a custom lookup, which reports the size of its index
+namespace N4
+{
+  enum class Indexed { a, b };
+  ENUM_STRINGS(Indexed, "a", "b");
+
+  inline bool _find_enum_string(char const * const s, std::size_t const length, Indexed & e) noexcept
+  {
+    return ::enum_strings::detail::find_string(s, length, e, 0L);
+  }
+
+  inline constexpr std::size_t _enum_strings_index_bytes(Indexed) noexcept
+  {
+    return 42;
+  }
+}
+
+// Distinct enumerations with the same name and strings, hence the same fingerprint
+namespace N6
+{
+  enum class Mode { on, off };
+  ENUM_STRINGS(Mode, "on", "off");
+}
+
+namespace N7
+{
+  enum class Mode { on, off };
+  ENUM_STRINGS(Mode, "on", "off");
+}
+
+std::size_t count_named(std::vector<enum_strings::registered_enum> const & registry, char const * const name)
+{
+  std::size_t n = 0;
+  for (auto const & r : registry)
+  {
+    n += std::strcmp(r.type_name, name) == 0 ? 1 : 0;
+  }
+  return n;
+}
+
+template <typename E>
+enum_strings::registered_enum const * find_registered(std::vector<enum_strings::registered_enum> const & registry)
+{
+  enum_strings::registered_enum const * result = nullptr;
+  for (auto const & r : registry)
+  {
+    if (r.fingerprint == enum_strings::fingerprint<E>())
+    {
+      assert(result == nullptr);
+      result = &r;
+    }
+  }
+  return result;
+}
+
+///////////////////////////////
+
+int main()
+{
+  assert(other_shared_name() == "two");
+
+  std::vector<enum_strings::registered_enum> const registry = enum_strings::registered_enums();
+#if ENUM_STRINGS_HAVE_REGISTRY
+  assert(registry.size() == 7);
+  for (std::size_t i = 1; i < registry.size(); ++i)
+  {
+    assert(std::strcmp(registry[i - 1].type_name, registry[i].type_name) <= 0);
+  }
+  assert(enum_strings::fingerprint<N6::Mode>() == enum_strings::fingerprint<N7::Mode>());
+  assert(count_named(registry, "Mode") == 2);
+
+  // Shared is registered in both translation units, but listed once
+  auto const * const shared = find_registered<N1::Shared>(registry);
+  assert(shared != nullptr);
+  assert(std::strcmp(shared->type_name, "Shared") == 0);
+  assert(shared->count == 3);
+  assert(shared->table_bytes == sizeof(enum_strings::detail::storage<N1::Shared>::type));
+  assert(shared->name_bytes == sizeof("Shared") + sizeof("one") + sizeof("two") + sizeof("three"));
+  assert(shared->index_bytes == 0);
+  assert(shared->total_bytes() == shared->table_bytes + shared->name_bytes);
+
+  auto const * const ext = find_registered<N1::Extern>(registry);
+  assert(ext != nullptr);
+  assert(std::strcmp(ext->type_name, "Extern") == 0);
+  assert(ext->count == 2);
+  assert(ext->table_bytes == sizeof(char const *) + 2 * (sizeof(char const *) + sizeof(std::size_t)) + sizeof(enum_strings::detail::extern_table));
+  assert(ext->name_bytes == sizeof("Extern") + sizeof("x") + sizeof("yy"));
+
+  assert(find_registered<N2::Local>(registry) != nullptr);
+  assert(find_registered<N3::Unused>(registry) != nullptr);
+  assert(find_registered<N3::Unused>(registry)->count == 1);
+  assert(find_registered<N4::Indexed>(registry) != nullptr);
+  assert(find_registered<N4::Indexed>(registry)->index_bytes == 42);
+
+  // The library has its own registry, merged on request
+  assert(test_registry_library_count() == 2);
+  std::vector<enum_strings::registered_enum> const merged = enum_strings::registered_enums({ enum_strings::module_registry(), test_registry_library() });
+  assert(merged.size() == 8);
+  assert(find_registered<N1::Shared>(merged) != nullptr);
+  assert(find_registered<N4::Indexed>(merged) != nullptr);
+  assert(count_named(merged, "Mode") == 2);
+  assert(std::strcmp(merged[5].type_name, "Plugin") == 0);
+#else
+  assert(registry.empty());
+  assert(test_registry_library_count() == 0);
+  assert(enum_strings::registered_enums({ enum_strings::module_registry(), test_registry_library() }).empty());
+#endif
+
+  return 0;
+}
@@ -0,0 +1,20 @@
+#ifndef ENUM_STRINGS_TEST_REGISTRY_H
+#define ENUM_STRINGS_TEST_REGISTRY_H
+
+#include "enum_strings.h"
+#include "enum_strings_registry.h"
+
+namespace N1
+{
+  enum class Shared { one, two, three, END };
+  ENUM_STRINGS(Shared, "one", "two", "three");
+
+  enum class Extern { x, yy, END };
+  ENUM_STRINGS_DECLARE(Extern);
+}
+
+// Defined in a shared library, which also registers Shared
+enum_strings::registry_range test_registry_library() noexcept;
+std::size_t test_registry_library_count();
+
+#endif //ENUM_STRINGS_TEST_REGISTRY_H
@@ -0,0 +1,15 @@
+#include "test_registry.h"
+
+namespace N5
+{
+  enum class Plugin { loaded, unloaded };
+  ENUM_STRINGS(Plugin, "loaded", "unloaded");
+}
+
+ENUM_STRINGS_EXPORT_REGISTRY(test_registry_library)
+
+std::size_t test_registry_library_count()
+{
+  // Shared and Plugin, read from the library even though the executable has the same function
+  return enum_strings::registered_enums().size();
+}
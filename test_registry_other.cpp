@@ -0,0 +1,13 @@
+#include "test_registry.h"
+
+#include <iostream>
+
+namespace N1
+{
+  ENUM_STRINGS_DEFINE(Extern, "x", "yy");
+}
+
+std::string other_shared_name()
+{
+  return enum_strings::to_string(N1::Shared::two);
+}
@@ -0,0 +1,103 @@
+#include "enum_strings_timeline.h"
+
+#include <cassert>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace N1
+{
+  enum class State { Idle, Running, Stalled, END };
+  ENUM_STRINGS(State, "Idle", "Running", "Stalled");
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::State;
+
+  enum_strings::enum_timeline<State> timeline;
+  std::vector<State> dense;
+
+  unsigned x = 7;
+  for (int k = 0; k < 1000; ++k)
+  {
+    x = x * 1103515245u + 12345u;
+    auto const e = static_cast<State>((x >> 16) % 3);
+    std::size_t const count = (x >> 8) % 50;
+    timeline.push_back(e, count);
+    dense.insert(dense.end(), count, e);
+  }
+  timeline.push_back(State::Idle);
+  dense.push_back(State::Idle);
+
+  assert(timeline.size() == dense.size());
+  assert(timeline.num_runs() < 1000);
+
+  for (std::size_t i = 0; i < dense.size(); ++i)
+  {
+    assert(timeline[i] == dense[i]);
+  }
+
+  for (std::size_t first : { std::size_t{0}, std::size_t{17}, dense.size() / 2, dense.size() - 1 })
+  {
+    std::size_t const count = std::min<std::size_t>(5000, dense.size() - first);
+    std::vector<State> decoded(count);
+    timeline.decode(first, count, decoded.data());
+    assert(std::equal(decoded.begin(), decoded.end(), dense.begin() + first));
+
+    std::uint64_t totals[3];
+    timeline.durations(first, count, totals);
+    for (std::size_t v = 0; v < 3; ++v)
+    {
+      assert(totals[v] == static_cast<std::uint64_t>(std::count(decoded.begin(), decoded.end(), static_cast<State>(v))));
+    }
+  }
+
+  std::uint64_t totals[3];
+  timeline.durations(totals);
+  assert(totals[0] + totals[1] + totals[2] == dense.size());
+  assert(totals[1] == static_cast<std::uint64_t>(std::count(dense.begin(), dense.end(), State::Running)));
+
+  bool thrown = false;
+  try
+  {
+    timeline.at(dense.size());
+  }
+  catch (std::out_of_range const & e)
+  {
+    thrown = true;
+    assert(std::string(e.what()) == "Sample " + std::to_string(dense.size()) + " is out of range, the timeline has "
+                                    + std::to_string(dense.size()) + " samples");
+  }
+  assert(thrown);
+
+  // values outside of the registered range are rejected before anything is stored
+  std::size_t const runs = timeline.num_runs();
+  for (auto const bad : { static_cast<State>(3), static_cast<State>(-1) })
+  {
+    thrown = false;
+    try
+    {
+      timeline.push_back(bad, 2);
+    }
+    catch (std::invalid_argument const &)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+  }
+  assert(timeline.size() == dense.size() && timeline.num_runs() == runs);
+
+  enum_strings::enum_timeline<State> small;
+  small.push_back(State::Idle, 3);
+  small.push_back(State::Idle, 2);
+  small.push_back(State::Running);
+  small.push_back(State::Stalled, 0);
+  std::ostringstream os;
+  os << small;
+  assert(os.str() == "Idle:5 Running:1");
+
+  return 0;
+}
@@ -0,0 +1,111 @@
+#include "enum_strings_writev.h"
+
+#include <cassert>
+#include <cstdio>
+
+#include <unistd.h>
+
+namespace N1
+{
+  enum class Level { Debug, Info, Critical, END };
+  ENUM_STRINGS(Level, "dbg", "info", "a rather long name that is referenced rather than copied");
+}
+
+std::string read_all(int const fd)
+{
+  std::string result;
+  char buf[4096];
+  ssize_t n;
+  while ((n = ::read(fd, buf, sizeof(buf))) > 0)
+  {
+    result.append(buf, static_cast<std::size_t>(n));
+  }
+  return result;
+}
+
+template <typename E>
+std::string expected_output(std::vector<E> const & values, std::string const & delimiter)
+{
+  std::string result;
+  for (E const e : values)
+  {
+    result += enum_strings::to_string(e) + delimiter;
+  }
+  return result;
+}
+
+///////////////////////////////
+
+int main()
+{
+  using N1::Level;
+
+  // pipe: small output fits into the pipe buffer
+  {
+    int fds[2];
+    int const rc = ::pipe(fds);
+    assert(rc == 0);
+    std::vector<Level> const values{ Level::Info, Level::Critical, Level::Debug, Level::Critical };
+    {
+      enum_strings::enum_writer<Level> writer(fds[1], ", ");
+      writer.write(values.data(), values.size());
+    }
+    ::close(fds[1]);
+    assert(read_all(fds[0]) == expected_output(values, ", "));
+    ::close(fds[0]);
+  }
+
+  // file: enough output to need several buffer flushes and IOV_MAX batches
+  for (std::size_t threshold : { 0, 16, 1000 })
+  {
+    std::FILE * const file = std::tmpfile();
+    assert(file != nullptr);
+    int const fd = ::fileno(file);
+
+    std::vector<Level> values;
+    for (std::size_t i = 0; i < 20000; ++i)
+    {
+      values.push_back(static_cast<Level>((i * 7 + i / 3) % 3));
+    }
+    {
+      enum_strings::enum_writer<Level> writer(fd, "\n", threshold);
+      writer.write(values.data(), values.size());
+      writer.flush();
+      writer.write(Level::Info);
+    }
+    values.push_back(Level::Info);
+
+    ::lseek(fd, 0, SEEK_SET);
+    assert(read_all(fd) == expected_output(values, "\n"));
+    std::fclose(file);
+  }
+
+  // invalid value and write error
+  {
+    enum_strings::enum_writer<Level> writer(-1);
+    bool thrown = false;
+    try
+    {
+      writer.write(static_cast<Level>(3));
+    }
+    catch (std::invalid_argument const &)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+
+    writer.write(Level::Info);
+    thrown = false;
+    try
+    {
+      writer.flush();
+    }
+    catch (std::system_error const &)
+    {
+      thrown = true;
+    }
+    assert(thrown);
+  }
+
+  return 0;
+}
@@ -0,0 +1,608 @@
+/**
+ * @file enum_strings_gen.cpp
+ * @author Sergey Klevtsov
+ * @brief Generate a header with an enumeration, its ENUM_STRINGS registration and a perfect hash lookup.
+ *
+ * Usage: enum_strings_gen [--front-coded[=<block size>]] <input> <output> <enum name> [<namespace>]
+ *
+ * The input has one entry per line, as comma-separated fields:
+ * @code
+ * name[,value[,alias ...]]
+ * @endcode
+ * Fields are trimmed and may be double-quoted (with "" for a quote); blank lines
+ * and lines starting with # are ignored. A missing value is the previous one plus 1
+ * (starting from 0), and the values must be a permutation of 0..N-1. Aliases are
+ * additional strings that are accepted by from_string but never produced by to_string;
+ * names and aliases must not be empty. Enumerators are made from the names by replacing
+ * other characters than letters and digits with '_' (once per run), and appending '_'
+ * to keywords.
+ *
+ * Lookup uses hash-and-displace: a 64-bit FNV-1a hash of the string selects a bucket,
+ * and a per-bucket seed found here places all keys of the bucket into distinct slots.
+ *
+ * With --front-coded, the names are instead stored front-coded in blocks of the given
+ * number of entries (16 by default) for the conversions in enum_strings_compressed.h,
+ * which suits very large enumerations whose names share long prefixes.
+ * The output file is only written if its contents change, so that dependent
+ * translation units are not rebuilt needlessly.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct entry
+{
+  std::string name;
+  std::string identifier;
+  long long value;
+  std::vector<std::string> aliases;
+};
+
+struct key
+{
+  std::string str;
+  std::size_t value;
+  std::uint64_t hash;
+};
+
+std::uint64_t fnv1a(std::string const & s)
+{
+  std::uint64_t h = 14695981039346656037ull;
+  for (char const c : s)
+  {
+    h = (h ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+  }
+  return h;
+}
+
+/// Must match the generated lookup function
+std::uint64_t mix(std::uint64_t h)
+{
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  return h;
+}
+
+std::string trim(std::string const & s)
+{
+  std::size_t const first = s.find_first_not_of(" \t\r");
+  std::size_t const last = s.find_last_not_of(" \t\r");
+  return first == std::string::npos ? std::string{} : s.substr(first, last - first + 1);
+}
+
+std::vector<std::string> split_fields(std::string const & line, std::size_t const line_number)
+{
+  std::vector<std::string> fields;
+  std::size_t i = 0;
+  while (true)
+  {
+    for (; i < line.size() && (line[i] == ' ' || line[i] == '\t'); ++i);
+    std::string field;
+    if (i < line.size() && line[i] == '"')
+    {
+      for (++i; ; ++i)
+      {
+        if (i == line.size())
+        {
+          throw std::runtime_error("line " + std::to_string(line_number) + ": unterminated quote");
+        }
+        if (line[i] == '"')
+        {
+          if (i + 1 < line.size() && line[i + 1] == '"') { field += '"'; ++i; }
+          else break;
+        }
+        else
+        {
+          field += line[i];
+        }
+      }
+      std::size_t const comma = line.find(',', ++i);
+      if (!trim(line.substr(i, comma - i)).empty())
+      {
+        throw std::runtime_error("line " + std::to_string(line_number) + ": unexpected text after quoted field");
+      }
+      i = comma;
+    }
+    else
+    {
+      std::size_t const comma = line.find(',', i);
+      field = trim(line.substr(i, comma - i));
+      i = comma;
+    }
+    fields.push_back(field);
+    if (i == std::string::npos) break;
+    ++i;
+  }
+  return fields;
+}
+
+/// Keywords and alternative tokens of C++ (up to C++20), which cannot be enumerators
+bool is_keyword(std::string const & id)
+{
+  static char const * const keywords[] =
+  {
+    "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break", "case", "catch",
+    "char", "char16_t", "char32_t", "char8_t", "class", "co_await", "co_return", "co_yield", "compl", "concept",
+    "const", "const_cast", "consteval", "constexpr", "constinit", "continue", "decltype", "default", "delete",
+    "do", "double", "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false", "float", "for",
+    "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq",
+    "nullptr", "operator", "or", "or_eq", "private", "protected", "public", "register", "reinterpret_cast",
+    "requires", "return", "short", "signed", "sizeof", "static", "static_assert", "static_cast", "struct",
+    "switch", "template", "this", "thread_local", "throw", "true", "try", "typedef", "typeid", "typename",
+    "union", "unsigned", "using", "virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq"
+  };
+  return std::find(std::begin(keywords), std::end(keywords), id) != std::end(keywords);
+}
+
+/**
+ * Make a valid enumerator from a name: other characters than letters and digits become '_',
+ * and the result is changed if it would be a keyword (by appending '_') or an identifier
+ * reserved to the implementation (containing "__" or starting with '_' and an uppercase letter).
+ */
+std::string make_identifier(std::string const & name)
+{
+  std::string id;
+  for (char const c : name)
+  {
+    bool const alnum = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+    if (alnum || id.empty() || id.back() != '_')
+    {
+      id += alnum ? c : '_';
+    }
+  }
+  if (id.size() > 1 && id[0] == '_' && id[1] >= 'A' && id[1] <= 'Z')
+  {
+    id.erase(0, 1);
+  }
+  if (id[0] >= '0' && id[0] <= '9')
+  {
+    id = "_" + id;
+  }
+  if (is_keyword(id))
+  {
+    id += '_';
+  }
+  return id;
+}
+
+std::vector<entry> read_entries(std::istream & is)
+{
+  std::vector<entry> entries;
+  long long next_value = 0;
+  std::string line;
+  for (std::size_t line_number = 1; std::getline(is, line); ++line_number)
+  {
+    std::string const trimmed = trim(line);
+    if (trimmed.empty() || trimmed[0] == '#') continue;
+
+    std::vector<std::string> const fields = split_fields(line, line_number);
+    entry e;
+    e.name = fields[0];
+    if (e.name.empty())
+    {
+      throw std::runtime_error("line " + std::to_string(line_number) + ": empty name");
+    }
+    e.identifier = make_identifier(e.name);
+    e.value = next_value;
+    if (fields.size() > 1 && !fields[1].empty())
+    {
+      std::size_t pos;
+      try
+      {
+        e.value = std::stoll(fields[1], &pos);
+      }
+      catch (std::exception const &)
+      {
+        pos = 0;
+      }
+      if (pos != fields[1].size())
+      {
+        throw std::runtime_error("line " + std::to_string(line_number) + ": invalid value '" + fields[1] + "'");
+      }
+    }
+    next_value = e.value + 1;
+    e.aliases.assign(fields.begin() + std::min<std::ptrdiff_t>(2, static_cast<std::ptrdiff_t>(fields.size())), fields.end());
+    for (std::string const & alias : e.aliases)
+    {
+      if (alias.empty())
+      {
+        throw std::runtime_error("line " + std::to_string(line_number) + ": empty alias");
+      }
+    }
+    entries.push_back(std::move(e));
+  }
+  if (entries.empty())
+  {
+    throw std::runtime_error("no names");
+  }
+
+  std::stable_sort(entries.begin(), entries.end(), [](entry const & a, entry const & b) { return a.value < b.value; });
+  std::map<std::string, std::string> identifiers;
+  for (std::size_t i = 0; i < entries.size(); ++i)
+  {
+    if (entries[i].value != static_cast<long long>(i))
+    {
+      throw std::runtime_error("values must be 0.." + std::to_string(entries.size() - 1) + " without gaps or duplicates, "
+                               "found " + std::to_string(entries[i].value) + " for '" + entries[i].name + "'");
+    }
+    if (entries[i].identifier == "END")
+    {
+      throw std::runtime_error("'END' is reserved");
+    }
+    auto const inserted = identifiers.emplace(entries[i].identifier, entries[i].name);
+    if (!inserted.second)
+    {
+      throw std::runtime_error("'" + inserted.first->second + "' and '" + entries[i].name + "' map to the same identifier");
+    }
+  }
+  return entries;
+}
+
+/// Placement of keys into slots
+struct perfect_hash
+{
+  std::vector<std::uint32_t> seeds;   // per bucket
+  std::vector<std::uint32_t> slots;   // key index + 1, or 0 if empty
+};
+
+perfect_hash build_hash(std::vector<key> const & keys)
+{
+  std::size_t const n = keys.size();
+  std::size_t const num_buckets = (n + 3) / 4;
+  std::size_t const num_slots = n + n / 4 + 1;
+
+  std::map<std::uint64_t, std::size_t> seen;
+  std::vector<std::vector<std::size_t>> buckets(num_buckets);
+  for (std::size_t k = 0; k < n; ++k)
+  {
+    auto const inserted = seen.emplace(keys[k].hash, k);
+    if (!inserted.second)
+    {
+      std::string const & other = keys[inserted.first->second].str;
+      throw std::runtime_error(other == keys[k].str ? "duplicate string '" + keys[k].str + "'"
+                                                    : "hash collision between '" + other + "' and '" + keys[k].str + "'");
+    }
+    buckets[(keys[k].hash >> 32) % num_buckets].push_back(k);
+  }
+
+  std::vector<std::size_t> order(num_buckets);
+  std::iota(order.begin(), order.end(), std::size_t{ 0 });
+  std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+  perfect_hash result{ std::vector<std::uint32_t>(num_buckets), std::vector<std::uint32_t>(num_slots) };
+  std::vector<std::size_t> placed;
+  for (std::size_t const b : order)
+  {
+    if (buckets[b].empty()) break;
+    bool found = false;
+    for (std::uint32_t seed = 0; seed < (1u << 24) && !found; ++seed)
+    {
+      placed.clear();
+      found = true;
+      for (std::size_t const k : buckets[b])
+      {
+        std::size_t const slot = mix(keys[k].hash ^ seed) % num_slots;
+        if (result.slots[slot] != 0 || std::find(placed.begin(), placed.end(), slot) != placed.end())
+        {
+          found = false;
+          break;
+        }
+        placed.push_back(slot);
+      }
+      if (found)
+      {
+        result.seeds[b] = seed;
+        for (std::size_t i = 0; i < placed.size(); ++i)
+        {
+          result.slots[placed[i]] = static_cast<std::uint32_t>(buckets[b][i] + 1);
+        }
+      }
+    }
+    if (!found)
+    {
+      throw std::runtime_error("failed to find a perfect hash");
+    }
+  }
+  return result;
+}
+
+std::string quote(std::string const & s)
+{
+  std::string result = "\"";
+  for (char const c : s)
+  {
+    auto const u = static_cast<unsigned char>(c);
+    if (c == '"' || c == '\\')
+    {
+      result += '\\';
+      result += c;
+    }
+    else if (u < 0x20 || u >= 0x7F || c == '?')
+    {
+      // always 3 octal digits, so that a following digit is not part of the escape; '?' avoids trigraphs
+      char buf[5];
+      std::snprintf(buf, sizeof(buf), "\\%03o", static_cast<unsigned>(u));
+      result += buf;
+    }
+    else
+    {
+      result += c;
+    }
+  }
+  return result + "\"";
+}
+
+template <typename T>
+void write_array(std::ostream & os, char const * const type, char const * const name, std::vector<T> const & values)
+{
+  os << "  static constexpr " << type << " " << name << "[] = {";
+  for (std::size_t i = 0; i < values.size(); ++i)
+  {
+    os << (i % 16 == 0 ? "\n    " : " ") << values[i] << (i + 1 < values.size() ? "," : "");
+  }
+  os << "\n  };\n";
+}
+
+void write_hash_lookup(std::ostream & os, std::vector<entry> const & entries, std::string const & enum_name)
+{
+  std::vector<key> keys;
+  for (std::size_t i = 0; i < entries.size(); ++i)
+  {
+    keys.push_back({ entries[i].name, i, fnv1a(entries[i].name) });
+  }
+  for (std::size_t i = 0; i < entries.size(); ++i)
+  {
+    for (std::string const & alias : entries[i].aliases)
+    {
+      keys.push_back({ alias, i, fnv1a(alias) });
+    }
+  }
+  perfect_hash const hash = build_hash(keys);
+
+  std::string pool;
+  std::vector<std::size_t> offsets, lengths, values;
+  for (key const & k : keys)
+  {
+    offsets.push_back(pool.size());
+    lengths.push_back(k.str.size());
+    values.push_back(k.value);
+    pool += k.str;
+  }
+
+  os << "ENUM_STRINGS(" << enum_name;
+  for (entry const & e : entries)
+  {
+    os << ",\n             " << quote(e.name);
+  }
+  os << ");\n\n";
+
+  os << "/// Perfect hash lookup of names and aliases, used by enum_strings::try_from_string\n"
+     << "inline bool _find_enum_string(char const * const s, std::size_t const length, " << enum_name << " & e) noexcept\n"
+     << "{\n"
+     << "  static constexpr char pool[] = " << quote(pool) << ";\n";
+  write_array(os, "std::uint32_t", "offsets", offsets);
+  write_array(os, "std::uint32_t", "lengths", lengths);
+  write_array(os, "std::uint32_t", "values", values);
+  write_array(os, "std::uint32_t", "seeds", hash.seeds);
+  write_array(os, "std::uint32_t", "slots", hash.slots);
+  os << "  std::uint64_t h = 14695981039346656037ull;\n"
+     << "  for (std::size_t i = 0; i < length; ++i)\n"
+     << "  {\n"
+     << "    h = (h ^ static_cast<unsigned char>(s[i])) * 1099511628211ull;\n"
+     << "  }\n"
+     << "  std::uint64_t m = h ^ seeds[(h >> 32) % " << hash.seeds.size() << "u];\n"
+     << "  m ^= m >> 33;\n"
+     << "  m *= 0xff51afd7ed558ccdull;\n"
+     << "  m ^= m >> 33;\n"
+     << "  std::uint32_t const k = slots[m % " << hash.slots.size() << "u];\n"
+     << "  if (k == 0 || lengths[k - 1] != length || std::memcmp(pool + offsets[k - 1], s, length) != 0)\n"
+     << "  {\n"
+     << "    return false;\n"
+     << "  }\n"
+     << "  e = static_cast<" << enum_name << ">(values[k - 1]);\n"
+     << "  return true;\n"
+     << "}\n\n";
+
+  std::size_t const index_bytes = pool.size() + 1
+    + (offsets.size() + lengths.size() + values.size() + hash.seeds.size() + hash.slots.size()) * sizeof(std::uint32_t);
+  os << "/// Size of the lookup tables above, reported by enum_strings::registered_enums\n"
+     << "inline constexpr std::size_t _enum_strings_index_bytes(" << enum_name << ") noexcept\n"
+     << "{\n"
+     << "  return " << index_bytes << ";\n"
+     << "}\n\n";
+}
+
+/// Must match the layout read by enum_strings::compressed::detail::decode
+void write_front_coded(std::ostream & os, std::vector<entry> const & entries, std::string const & enum_name,
+                       std::size_t const block_size)
+{
+  struct coded_key
+  {
+    std::string str;
+    std::size_t value;
+    bool alias;
+  };
+  std::vector<coded_key> keys;
+  for (std::size_t i = 0; i < entries.size(); ++i)
+  {
+    keys.push_back({ entries[i].name, i, false });
+    for (std::string const & alias : entries[i].aliases)
+    {
+      keys.push_back({ alias, i, true });
+    }
+  }
+  std::sort(keys.begin(), keys.end(), [](coded_key const & a, coded_key const & b) { return a.str < b.str; });
+
+  std::string data = "  static constexpr char data[] =";
+  std::vector<std::uint32_t> block_offsets, ranks(entries.size()), values;
+  std::size_t max_length = 0;
+  std::size_t data_size = 0;
+  for (std::size_t i = 0; i < keys.size(); ++i)
+  {
+    std::string const & str = keys[i].str;
+    if (str.size() > 255)
+    {
+      throw std::runtime_error("'" + str.substr(0, 32) + "...' is longer than 255 characters");
+    }
+    if (i > 0 && str == keys[i - 1].str)
+    {
+      throw std::runtime_error("duplicate string '" + str + "'");
+    }
+    std::size_t prefix = 0;
+    if (i % block_size == 0)
+    {
+      block_offsets.push_back(static_cast<std::uint32_t>(data_size));
+      data += "\n   ";
+    }
+    else
+    {
+      std::string const & prev = keys[i - 1].str;
+      for (; prefix < str.size() && prefix < prev.size() && str[prefix] == prev[prefix]; ++prefix);
+    }
+    data += " " + quote(std::string{ static_cast<char>(prefix), static_cast<char>(str.size() - prefix) } + str.substr(prefix));
+    data_size += 2 + str.size() - prefix;
+    max_length = std::max(max_length, str.size());
+    values.push_back(static_cast<std::uint32_t>(keys[i].value));
+    if (!keys[i].alias)
+    {
+      ranks[keys[i].value] = static_cast<std::uint32_t>(i);
+    }
+  }
+
+  os << "/// Front-coded names and aliases, used by the conversions in enum_strings::compressed\n"
+     << "inline ::enum_strings::compressed::front_coded_table const & _get_front_coded_names(" << enum_name << ") noexcept\n"
+     << "{\n"
+     << data << ";\n";
+  write_array(os, "std::uint32_t", "block_offsets", block_offsets);
+  write_array(os, "std::uint32_t", "ranks", ranks);
+  write_array(os, "std::uint32_t", "values", values);
+  os << "  static constexpr ::enum_strings::compressed::front_coded_table table{\n"
+     << "    " << entries.size() << ", " << keys.size() << ", " << block_size << ", " << max_length << ", " << data_size << ",\n"
+     << "    data, block_offsets, ranks, values\n"
+     << "  };\n"
+     << "  return table;\n"
+     << "}\n\n";
+}
+
+std::string generate(std::vector<entry> const & entries, std::string const & input, std::string const & output,
+                     std::string const & enum_name, std::string const & ns, std::size_t const block_size)
+{
+  std::string guard = "ENUM_STRINGS_GENERATED_";
+  for (char const c : output.substr(output.find_last_of("/\\") + 1))
+  {
+    guard += (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) ? c : '_';
+  }
+
+  std::vector<std::string> namespaces;
+  for (std::size_t pos = 0; !ns.empty(); pos += 2)
+  {
+    std::size_t const next = ns.find("::", pos);
+    namespaces.push_back(ns.substr(pos, next - pos));
+    if (next == std::string::npos) break;
+    pos = next;
+  }
+
+  std::ostringstream os;
+  os << "// Generated by enum_strings_gen from " << input.substr(input.find_last_of("/\\") + 1) << ". Do not edit.\n"
+     << "#ifndef " << guard << "\n"
+     << "#define " << guard << "\n\n"
+     << "#include \"" << (block_size > 0 ? "enum_strings_compressed.h" : "enum_strings.h") << "\"\n\n";
+  for (std::string const & n : namespaces)
+  {
+    os << "namespace " << n << "\n{\n\n";
+  }
+
+  os << "enum class " << enum_name << "\n{";
+  for (entry const & e : entries)
+  {
+    os << "\n  " << e.identifier << ",";
+  }
+  os << "\n  END\n};\n\n";
+
+  if (block_size > 0)
+  {
+    write_front_coded(os, entries, enum_name, block_size);
+  }
+  else
+  {
+    write_hash_lookup(os, entries, enum_name);
+  }
+
+  for (auto it = namespaces.rbegin(); it != namespaces.rend(); ++it)
+  {
+    os << "} // namespace " << *it << "\n\n";
+  }
+  os << "#endif //" << guard << "\n";
+  return os.str();
+}
+
+} // namespace
+
+int main(int argc, char ** argv)
+{
+  std::size_t block_size = 0;
+  std::string const option = argc > 1 ? argv[1] : "";
+  if (option.compare(0, 13, "--front-coded") == 0)
+  {
+    block_size = option.size() > 14 && option[13] == '=' ? std::strtoul(option.c_str() + 14, nullptr, 10) : 16;
+    block_size = option.size() == 13 || option[13] == '=' ? block_size : 0;
+    --argc;
+    ++argv;
+    if (block_size == 0)
+    {
+      std::cerr << "Invalid option " << option << "\n";
+      return 2;
+    }
+  }
+  if (argc < 4 || argc > 5)
+  {
+    std::cerr << "Usage: " << argv[0] << " [--front-coded[=<block size>]] <input> <output> <enum name> [<namespace>]\n";
+    return 2;
+  }
+  std::string const input = argv[1];
+  std::string const output = argv[2];
+
+  std::string contents;
+  try
+  {
+    std::ifstream is(input);
+    if (!is)
+    {
+      throw std::runtime_error("cannot open");
+    }
+    contents = generate(read_entries(is), input, output, argv[3], argc > 4 ? argv[4] : "", block_size);
+  }
+  catch (std::exception const & e)
+  {
+    std::cerr << input << ": " << e.what() << "\n";
+    return 1;
+  }
+
+  std::ifstream existing(output, std::ios::binary);
+  std::string const old{ std::istreambuf_iterator<char>(existing), std::istreambuf_iterator<char>() };
+  if (existing && old == contents)
+  {
+    return 0;
+  }
+  std::ofstream os(output, std::ios::binary | std::ios::trunc);
+  if (!(os << contents))
+  {
+    std::cerr << output << ": cannot write\n";
+    return 1;
+  }
+  return 0;
+}